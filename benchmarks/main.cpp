@@ -0,0 +1,316 @@
+#include <benchmark/benchmark.h>
+
+#include <utf8/utf8.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr std::size_t CORPUS_SIZE = std::size_t{ 1U } << 20U;
+
+    struct Range {
+        char32_t first;
+        char32_t last;
+        double   weight;
+    };
+
+    struct Corpus {
+        std::string    name;
+        std::u8string  text;
+        std::u32string codepoints;
+    };
+
+    constexpr Range ASCII{ U' ', U'~', 1.0 };
+    constexpr Range LATIN_1{ U'\u00A0', U'\u00FF', 1.0 };
+    constexpr Range CJK{ U'\u4E00', U'\u9FFF', 1.0 };
+    constexpr Range EMOJI{ U'\U0001F300', U'\U0001F64F', 1.0 };
+
+    [[nodiscard]] constexpr auto weighted(Range range, const double weight) noexcept -> Range {
+        range.weight = weight;
+
+        return range;
+    }
+
+    // Text of about CORPUS_SIZE bytes drawn from `ranges`, with `invalid_ratio` of its bytes overwritten by
+    // random non-ASCII bytes.
+    [[nodiscard]] auto generate(const std::vector<Range>& ranges, const double invalid_ratio) -> std::u8string {
+        std::mt19937 engine{ 42U };
+
+        std::vector<double> weights;
+        for(const auto& range : ranges) {
+            weights.push_back(range.weight);
+        }
+
+        std::discrete_distribution<std::size_t> pick{ weights.begin(), weights.end() };
+
+        std::u8string result;
+        result.reserve(CORPUS_SIZE + 4U);
+
+        while(result.size() < CORPUS_SIZE) {
+            const auto& range = ranges[pick(engine)];
+
+            std::uniform_int_distribution<std::uint32_t> codepoint{ range.first, range.last };
+
+            const auto units = *utf8::encode(static_cast<char32_t>(codepoint(engine)));
+            result.append(units.begin(), units.end());
+        }
+
+        std::uniform_int_distribution<std::size_t> position{ 0U, result.size() - 1U };
+        std::uniform_int_distribution<int>          byte{ 0x80, 0xFF };
+
+        const auto corrupted = static_cast<std::size_t>(static_cast<double>(result.size()) * invalid_ratio);
+        for(std::size_t i = 0U; i < corrupted; ++i) {
+            result[position(engine)] = static_cast<char8_t>(byte(engine));
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] auto corpora() -> std::vector<Corpus> {
+        const std::vector<Range> mixed = { ASCII, LATIN_1, CJK, EMOJI };
+
+        const std::vector<std::pair<std::string, std::u8string>> texts = {
+            { "ascii", generate({ ASCII }, 0.0) },
+            { "latin1", generate({ weighted(ASCII, 0.6), weighted(LATIN_1, 0.4) }, 0.0) },
+            { "cjk", generate({ weighted(ASCII, 0.1), weighted(CJK, 0.9) }, 0.0) },
+            { "emoji", generate({ weighted(ASCII, 0.4), weighted(EMOJI, 0.6) }, 0.0) },
+            { "mixed", generate(mixed, 0.0) },
+            { "invalid_0.1%", generate(mixed, 0.001) },
+            { "invalid_1%", generate(mixed, 0.01) },
+            { "invalid_10%", generate(mixed, 0.1) },
+        };
+
+        std::vector<Corpus> result;
+        for(const auto& [name, text] : texts) {
+            std::u32string codepoints;
+            utf8::ranges::decode_all(text, std::back_inserter(codepoints));
+
+            result.push_back({ name, text, std::move(codepoints) });
+        }
+
+        return result;
+    }
+
+    // Throughput is reported against the UTF-8 size of the corpus for every benchmark, so the rates are comparable.
+    auto set_rates(benchmark::State& state, const Corpus& corpus) -> void {
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * corpus.text.size()));
+
+        state.counters["codepoints/s"] = benchmark::Counter{
+            static_cast<double>(corpus.codepoints.size()),
+            benchmark::Counter::kIsIterationInvariantRate,
+        };
+    }
+
+    auto is_valid(benchmark::State& state, const Corpus& corpus) -> void {
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::is_valid(corpus.text));
+        }
+
+        set_rates(state, corpus);
+    }
+
+    // The corpus as a column of short fields like the values of a database import, split between sequences.
+    [[nodiscard]] auto field_offsets(const Corpus& corpus) -> std::vector<std::int64_t> {
+        std::mt19937                               engine{ 42U };
+        std::uniform_int_distribution<std::size_t> size{ 5U, 200U };
+
+        std::vector<std::int64_t> result{ 0 };
+        for(std::size_t offset = 0U; offset < corpus.text.size();) {
+            offset = std::min(offset + size(engine), corpus.text.size());
+            while(offset < corpus.text.size() && (corpus.text[offset] & 0xC0U) == 0x80U) {
+                ++offset;
+            }
+
+            result.push_back(static_cast<std::int64_t>(offset));
+        }
+
+        return result;
+    }
+
+    auto is_valid_fields(benchmark::State& state, const Corpus& corpus) -> void {
+        const auto         offsets = field_offsets(corpus);
+        std::u8string_view text{ corpus.text };
+
+        for(auto _ : state) {
+            std::size_t invalid = 0U;
+            for(std::size_t i = 0U; i + 1U < offsets.size(); ++i) {
+                const auto first = static_cast<std::size_t>(offsets[i]);
+                const auto last  = static_cast<std::size_t>(offsets[i + 1U]);
+
+                invalid += utf8::ranges::is_valid(text.substr(first, last - first)) ? 0U : 1U;
+            }
+
+            benchmark::DoNotOptimize(invalid);
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto batch_validate(benchmark::State& state, const Corpus& corpus) -> void {
+        const auto                offsets = field_offsets(corpus);
+        std::vector<std::uint8_t> bitmap(offsets.size() / 8U + 1U);
+
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::batch::validate(corpus.text, offsets, bitmap));
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto length(benchmark::State& state, const Corpus& corpus) -> void {
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::length(corpus.text));
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto repair(benchmark::State& state, const Corpus& corpus) -> void {
+        std::u8string output(corpus.text.size() * 3U, u8'\0');
+
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::repair(corpus.text, output.data()));
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto decode_all(benchmark::State& state, const Corpus& corpus) -> void {
+        std::u32string output(corpus.text.size(), U'\0');
+
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::decode_all(corpus.text, output.data()));
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto decode_unchecked(benchmark::State& state, const Corpus& corpus) -> void {
+        const auto     valid = utf8::ranges::validated(corpus.text).value();
+        std::u32string output(corpus.text.size(), U'\0');
+
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::decode_unchecked(valid, output.data()));
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto encode_all(benchmark::State& state, const Corpus& corpus) -> void {
+        std::u8string output(corpus.codepoints.size() * 4U, u8'\0');
+
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::encode_all(corpus.codepoints, output.data()));
+            benchmark::ClobberMemory();
+        }
+
+        set_rates(state, corpus);
+    }
+
+    auto split_on(benchmark::State& state, const Corpus& corpus) -> void {
+        for(auto _ : state) {
+            std::size_t pieces = 0U;
+            for(const auto piece : corpus.text | utf8::views::split_on(U' ')) {
+                benchmark::DoNotOptimize(piece);
+                ++pieces;
+            }
+
+            benchmark::DoNotOptimize(pieces);
+        }
+
+        set_rates(state, corpus);
+    }
+
+    // Searches for line and paragraph separators, which are not in the corpora, so runs of ASCII are skipped.
+    auto find_any_of(benchmark::State& state, const Corpus& corpus) -> void {
+        for(auto _ : state) {
+            benchmark::DoNotOptimize(utf8::ranges::find_any_of(corpus.text, U"\u2028\u2029"));
+        }
+
+        set_rates(state, corpus);
+    }
+
+    template<typename V>
+    auto iterate(benchmark::State& state, const Corpus& corpus, V view) -> void {
+        for(auto _ : state) {
+            char32_t sum = 0U;
+            for(const char32_t codepoint : corpus.text | view) {
+                sum += codepoint;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_rates(state, corpus);
+    }
+}
+
+// Reports are written as JSON unless another --benchmark_format is given, so results can be diffed across commits,
+// for example with Google Benchmark's tools/compare.py.
+auto main(int argc, char** argv) -> int {
+    std::vector<char*> arguments(argv, argv + argc);
+
+    const bool has_format = std::ranges::any_of(arguments, [](const char* argument) {
+        return std::string_view{ argument }.starts_with("--benchmark_format");
+    });
+
+    std::string json_format = "--benchmark_format=json";
+    if(!has_format) {
+        arguments.insert(arguments.begin() + 1, json_format.data());
+    }
+
+    argc = static_cast<int>(arguments.size());
+    argv = arguments.data();
+
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    static const auto all = corpora();
+
+    for(const auto& corpus : all) {
+        const auto name = [&](const std::string_view algorithm) {
+            return std::string{ algorithm } + "/" + corpus.name;
+        };
+
+        benchmark::RegisterBenchmark(name("is_valid").c_str(), is_valid, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("length").c_str(), length, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("is_valid_fields").c_str(), is_valid_fields, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("batch::validate").c_str(), batch_validate, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("repair").c_str(), repair, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("decode_all").c_str(), decode_all, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("encode_all").c_str(), encode_all, std::cref(corpus));
+
+        if(utf8::ranges::is_valid(corpus.text)) {
+            benchmark::RegisterBenchmark(name("decode_unchecked").c_str(), decode_unchecked, std::cref(corpus));
+        }
+
+        benchmark::RegisterBenchmark(name("find_any_of").c_str(), find_any_of, std::cref(corpus));
+        benchmark::RegisterBenchmark(name("views::split_on").c_str(), split_on, std::cref(corpus));
+
+        benchmark::RegisterBenchmark(name("views::decode").c_str(), [&](benchmark::State& state) {
+            iterate(state, corpus, utf8::views::decode);
+        });
+        benchmark::RegisterBenchmark(name("views::sanitize").c_str(), [&](benchmark::State& state) {
+            iterate(state, corpus, utf8::views::sanitize);
+        });
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -1,19 +1,101 @@
 #pragma once
 
 #include "error.hpp"
+#include "simd.hpp"
 #include "validation.hpp"
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <iterator>
+#include <memory>
 #include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace utf8 {
+    namespace detail {
+        template<typename I, typename S>
+        concept contiguous_source = std::contiguous_iterator<I> && std::sized_sentinel_for<S, I>;
+
+        // Hands the run of ASCII units at the front of [it, end) to `consume` in one piece and steps over it.
+        // Only contiguous sources are scanned, and never during constant evaluation.
+        template<std::input_iterator I, std::sentinel_for<I> S, typename F>
+        constexpr auto skip_ascii(I& it, const S& end, F&& consume) noexcept -> void {
+            if constexpr(contiguous_source<I, S>) {
+                if !consteval {
+                    using T = std::iter_value_t<I>;
+
+                    const T* const first = std::to_address(it);
+                    const T* const last  = simd::skip_ascii(first, first + (end - it));
+
+                    if(last != first) {
+                        std::forward<F>(consume)(std::span<const T>{ first, last });
+
+                        it += last - first;
+                    }
+                }
+            }
+        }
+
+        template<typename O, typename T>
+        struct is_string_inserter : std::false_type {};
+
+        template<typename T, typename Traits, typename Allocator>
+        struct is_string_inserter<std::back_insert_iterator<std::basic_string<T, Traits, Allocator>>, T>
+            : std::true_type {};
+
+        // Outputs a bulk kernel can write into directly: contiguous storage, or the end of a string.
+        template<typename O, typename T>
+        concept bulk_output =
+            (std::contiguous_iterator<O> && std::same_as<std::iter_value_t<O>, T> && std::output_iterator<O, T>) ||
+            is_string_inserter<O, T>::value;
+
+        template<typename C>
+        [[nodiscard]] auto container_of(std::back_insert_iterator<C>& out) noexcept -> C& {
+            struct Access : std::back_insert_iterator<C> {
+                [[nodiscard]] static auto get(std::back_insert_iterator<C>& it) noexcept -> C& {
+                    return *(it.*&Access::container);
+                }
+            };
+
+            return Access::get(out);
+        }
+
+        // Lets `transcode` write at most `capacity` units to raw storage at `out`, then advances `out` by the
+        // count it returns. Strings are grown once and shrunk back instead of being appended to unit by unit.
+        template<typename T, bulk_output<T> O, typename F>
+        auto write_bulk(O& out, const std::size_t capacity, F&& transcode) noexcept -> void {
+            if constexpr(is_string_inserter<O, T>::value) {
+                auto&      string = container_of(out);
+                const auto offset = string.size();
+
+                string.resize_and_overwrite(offset + capacity, [&](T* const data, std::size_t) noexcept {
+                    return offset + std::forward<F>(transcode)(data + offset);
+                });
+            } else {
+                out += static_cast<std::iter_difference_t<O>>(std::forward<F>(transcode)(std::to_address(out)));
+            }
+        }
+    }
+
     template<std::input_iterator I, std::sentinel_for<I> S>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     [[nodiscard]] constexpr auto is_valid(I it, S end) noexcept -> bool {
+        if constexpr(std::contiguous_iterator<I> && std::sized_sentinel_for<S, I>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::validate({ std::to_address(it), size });
+            }
+        }
+
         while(it != end) {
             auto [new_it, codepoint] = decode(std::move(it), end);
             if(!codepoint) {
@@ -26,9 +108,70 @@ namespace utf8 {
         return true;
     }
 
+    // Where validation stopped: the first unit of the first ill-formed sequence, or the end, and how many units
+    // precede it.
+    template<typename I>
+    struct ValidateResult {
+        I              in;
+        std::size_t    valid;
+        Expected<void> result;
+    };
+
+    // As `ValidateResult` for a strict transcoder, plus the end of its output.
+    template<typename I, typename O>
+    struct CheckedResult {
+        I              in;
+        O              out;
+        std::size_t    valid;
+        Expected<void> result;
+    };
+
+    template<std::forward_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto validate(I it, S end) noexcept -> ValidateResult<I> {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                const auto valid = detail::simd::valid_prefix(input);
+
+                it += static_cast<std::iter_difference_t<I>>(valid);
+
+                if(valid == input.size()) {
+                    return { std::move(it), valid, {} };
+                }
+
+                return { it, valid, Unexpected{ decode(it, end).second.error() } };
+            }
+        }
+
+        std::size_t valid = 0U;
+
+        while(it != end) {
+            auto [new_it, codepoint] = decode(it, end);
+            if(!codepoint) {
+                return { std::move(it), valid, Unexpected{ codepoint.error() } };
+            }
+
+            valid += static_cast<std::size_t>(std::ranges::distance(it, new_it));
+
+            it = std::move(new_it);
+        }
+
+        return { std::move(it), valid, {} };
+    }
+
     template<std::input_iterator I, std::sentinel_for<I> S>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     [[nodiscard]] constexpr auto length(I it, S end) noexcept -> Expected<std::size_t> {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::length({ std::to_address(it), size });
+            }
+        }
+
         std::size_t result = 0U;
 
         while(it != end) {
@@ -45,10 +188,321 @@ namespace utf8 {
         return result;
     }
 
+    // Number of codepoints in [it, end), which must already be known to be valid.
+    // Only units that do not continue a sequence are counted; nothing is decoded or checked.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto length_unchecked(I it, S end) noexcept -> std::size_t {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::count({ std::to_address(it), size });
+            }
+        }
+
+        std::size_t result = 0U;
+
+        for(; it != end; ++it) {
+            if((*it & ~detail::CONTINUATION_UNIT_MASK) != detail::CONTINUATION_UNIT_HEADER) {
+                ++result;
+            }
+        }
+
+        return result;
+    }
+
+    // Units that passed validation. Only `validated` makes one from other units, so holding one proves that they
+    // are valid UTF-8, and what is given one can skip every check, like `decode_unchecked` and
+    // `length_unchecked` do. It views the units, which must outlive it.
+    class ValidView : public std::ranges::view_interface<ValidView> {
+    public:
+        ValidView() = default;
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const char8_t* {
+            return m_units.data();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const char8_t* {
+            return m_units.data() + m_units.size();
+        }
+
+        [[nodiscard]] constexpr auto view() const noexcept -> std::u8string_view {
+            return { begin(), end() };
+        }
+
+    private:
+        std::span<const char8_t> m_units;
+
+        explicit constexpr ValidView(const std::span<const char8_t> units) noexcept
+            : m_units{ units } {}
+
+        template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+            requires std::same_as<std::iter_value_t<I>, char8_t>
+        friend constexpr auto validated(I it, S end) noexcept -> Expected<ValidView>;
+    };
+}
+
+template<>
+inline constexpr bool std::ranges::enable_borrowed_range<utf8::ValidView> = true;
+
+namespace utf8 {
+
+    // Validates [it, end) once, for everything that is given the result to trust.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto validated(I it, S end) noexcept -> Expected<ValidView> {
+        const std::span<const char8_t> units{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        const auto checked = validate(units.begin(), units.end());
+        if(!checked.result) {
+            return Unexpected{ checked.result.error() };
+        }
+
+        return ValidView{ units };
+    }
+
+    namespace detail {
+        // Offset of the leading unit of codepoint `count` of `units`, or their size if it has fewer. Codepoints
+        // are counted as the units that do not continue a sequence, as `length_unchecked` does.
+        [[nodiscard]] constexpr auto codepoint_offset(const std::span<const char8_t> units, const std::size_t count) noexcept -> std::size_t {
+            if !consteval {
+                return simd::skip(units, count).offset;
+            }
+
+            std::size_t offset  = 0U;
+            std::size_t skipped = 0U;
+
+            for(; offset < units.size(); ++offset) {
+                if(is_continuation(units[offset])) {
+                    continue;
+                }
+
+                if(skipped == count) {
+                    break;
+                }
+
+                ++skipped;
+            }
+
+            return offset;
+        }
+    }
+
+    // The longest prefix of [it, end) of at most `count` units that does not end inside a sequence. Only the end
+    // is looked at: at most 3 continuation units are stepped back over, and more are ill-formed, so the prefix
+    // then just ends after `count` units.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto truncate_bytes(I it, S end, const std::size_t count) noexcept -> std::ranges::subrange<I> {
+        const auto size = static_cast<std::size_t>(end - it);
+        if(count >= size) {
+            return { it, it + static_cast<std::iter_difference_t<I>>(size) };
+        }
+
+        std::size_t last = count;
+        for(std::size_t i = 0U; i < 3U && last != 0U && detail::is_continuation(it[last]); ++i) {
+            --last;
+        }
+
+        if(detail::is_continuation(it[last])) {
+            last = count;
+        }
+
+        return { it, it + static_cast<std::iter_difference_t<I>>(last) };
+    }
+
+    // The first `count` codepoints of [it, end), or all of them, counted like `length_unchecked` does.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto take_codepoints(I it, S end, const std::size_t count) noexcept -> std::ranges::subrange<I> {
+        const std::span<const char8_t> units{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        return { it, it + static_cast<std::iter_difference_t<I>>(detail::codepoint_offset(units, count)) };
+    }
+
+    // What follows the first `count` codepoints of [it, end).
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto drop_codepoints(I it, S end, const std::size_t count) noexcept -> std::ranges::subrange<I> {
+        const std::span<const char8_t> units{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        const auto first = static_cast<std::iter_difference_t<I>>(detail::codepoint_offset(units, count));
+        const auto last  = static_cast<std::iter_difference_t<I>>(units.size());
+
+        return { it + first, it + last };
+    }
+
+    namespace detail {
+        // Offset of the first occurrence of the non-empty `needle` in `units`, or their size. Its leading unit is
+        // searched for with `memchr`, and the rest of it compared where one is found.
+        [[nodiscard]] constexpr auto find_units(
+            const std::span<const char8_t> units,
+            const std::span<const char8_t> needle
+        ) noexcept -> std::size_t {
+            if(units.size() < needle.size()) {
+                return units.size();
+            }
+
+            if !consteval {
+                const char8_t* const first = units.data();
+                const char8_t* const last  = first + units.size() - needle.size() + 1U;
+
+                for(const char8_t* it = first; it != last; ++it) {
+                    it = static_cast<const char8_t*>(std::memchr(it, needle.front(), static_cast<std::size_t>(last - it)));
+                    if(it == nullptr) {
+                        break;
+                    }
+
+                    if(std::memcmp(it + 1, needle.data() + 1, needle.size() - 1U) == 0) {
+                        return static_cast<std::size_t>(it - first);
+                    }
+                }
+
+                return units.size();
+            }
+
+            return static_cast<std::size_t>(std::ranges::search(units, needle).begin() - units.begin());
+        }
+
+        // Offset of the first sequence of `units` that decodes to a codepoint of `set`, or their size. Only
+        // sequences starting with the leading unit of a member are decoded. When the members share one leading
+        // unit it is searched for with `memchr`; otherwise units are looked up in a table, and if no member is
+        // ASCII, runs of ASCII units are skipped with the vector scan.
+        [[nodiscard]] constexpr auto find_any_of(
+            const std::span<const char8_t> units,
+            const std::u32string_view      set
+        ) noexcept -> std::size_t {
+            std::array<bool, 256U> leading{};
+            std::size_t            leading_count = 0U;
+            char8_t                lead          = 0U;
+
+            for(const char32_t codepoint : set) {
+                if(const auto encoded = encode(codepoint); encoded && !leading[*encoded->begin()]) {
+                    lead          = *encoded->begin();
+                    leading[lead] = true;
+                    ++leading_count;
+                }
+            }
+
+            const auto matches = [&](const std::size_t offset) noexcept {
+                const auto [it, codepoint] = decode(units.begin() + static_cast<std::ptrdiff_t>(offset), units.end());
+
+                return codepoint && set.contains(*codepoint);
+            };
+
+            if(leading_count == 0U) {
+                return units.size();
+            }
+
+            if !consteval {
+                const char8_t* const first = units.data();
+                const char8_t* const last  = first + units.size();
+
+                if(leading_count == 1U) {
+                    for(const char8_t* it = first; it != last; ++it) {
+                        it = static_cast<const char8_t*>(std::memchr(it, lead, static_cast<std::size_t>(last - it)));
+                        if(it == nullptr) {
+                            break;
+                        }
+
+                        if(matches(static_cast<std::size_t>(it - first))) {
+                            return static_cast<std::size_t>(it - first);
+                        }
+                    }
+
+                    return units.size();
+                }
+
+                const bool skips_ascii = std::ranges::none_of(std::span{ leading }.first(0x80U), std::identity{});
+
+                for(const char8_t* it = first; it != last;) {
+                    if(skips_ascii && *it < 0x80U) {
+                        it = simd::skip_ascii(it, last);
+                        continue;
+                    }
+
+                    if(leading[*it] && matches(static_cast<std::size_t>(it - first))) {
+                        return static_cast<std::size_t>(it - first);
+                    }
+
+                    ++it;
+                }
+
+                return units.size();
+            }
+
+            for(std::size_t offset = 0U; offset < units.size(); ++offset) {
+                if(leading[units[offset]] && matches(offset)) {
+                    return offset;
+                }
+            }
+
+            return units.size();
+        }
+    }
+
+    // The units of the first occurrence of `codepoint` in [it, end), or an empty range at the end. The codepoint
+    // is encoded once and its units searched for as a whole, so valid text is not decoded at all; an invalid
+    // codepoint is never found.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto find(I it, S end, const char32_t codepoint) noexcept -> std::ranges::subrange<I> {
+        const std::span<const char8_t> units{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        const auto last = it + static_cast<std::iter_difference_t<I>>(units.size());
+
+        const auto encoded = encode(codepoint);
+        if(!encoded) {
+            return { last, last };
+        }
+
+        const std::span<const char8_t> needle{ encoded->begin(), encoded->end() };
+
+        const auto offset = detail::find_units(units, needle);
+        if(offset == units.size()) {
+            return { last, last };
+        }
+
+        const auto first = it + static_cast<std::iter_difference_t<I>>(offset);
+
+        return { first, first + static_cast<std::iter_difference_t<I>>(needle.size()) };
+    }
+
+    // The units of the first codepoint of [it, end) that is in `set`, or an empty range at the end.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto find_any_of(I it, S end, const std::u32string_view set) noexcept -> std::ranges::subrange<I> {
+        if(set.size() == 1U) {
+            return utf8::find(std::move(it), std::move(end), set.front());
+        }
+
+        const std::span<const char8_t> units{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        const auto offset = detail::find_any_of(units, set);
+        const auto first  = it + static_cast<std::iter_difference_t<I>>(offset);
+
+        if(offset == units.size()) {
+            return { first, first };
+        }
+
+        const auto [next, codepoint] = decode(units.begin() + static_cast<std::ptrdiff_t>(offset), units.end());
+
+        return { first, it + static_cast<std::iter_difference_t<I>>(next - units.begin()) };
+    }
+
     template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     constexpr auto repair(I it, S end, O out) noexcept -> O {
         while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                out = std::ranges::copy(run, std::move(out)).out;
+            });
+
+            if(it == end) {
+                break;
+            }
+
             auto [new_it, codepoint] = decode(std::move(it), end);
 
             const auto units = *encode(codepoint.value_or(REPLACEMENT));
@@ -61,10 +515,73 @@ namespace utf8 {
         return out;
     }
 
+    // The units `repair` writes for some input: a view of the input itself if it is valid, or else a repaired copy.
+    class Repaired {
+    public:
+        explicit constexpr Repaired(const std::u8string_view input) noexcept
+            : m_input{ input } {}
+
+        constexpr Repaired(const std::u8string_view input, std::u8string repaired) noexcept
+            : m_input{ input }, m_repaired{ std::move(repaired) }, m_is_copy{ true } {}
+
+        [[nodiscard]] constexpr auto view() const noexcept -> std::u8string_view {
+            return m_is_copy ? std::u8string_view{ m_repaired } : m_input;
+        }
+
+        // Whether the input had to be repaired, and the units were copied.
+        [[nodiscard]] constexpr auto is_copy() const noexcept -> bool {
+            return m_is_copy;
+        }
+
+        [[nodiscard]] constexpr auto data() const noexcept -> const char8_t* {
+            return view().data();
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return view().size();
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept {
+            return view().begin();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept {
+            return view().end();
+        }
+
+    private:
+        std::u8string_view m_input;
+        std::u8string      m_repaired;
+        bool               m_is_copy{ false };
+    };
+
     template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char32_t> O>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     constexpr auto decode_all(I it, S end, O out) noexcept -> O {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char32_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::write_bulk<char32_t>(out, input.size(), [&](char32_t* const first) noexcept {
+                    return detail::simd::decode_all(input, first);
+                });
+
+                return out;
+            }
+        }
+
         while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char8_t unit : run) {
+                    *out = static_cast<char32_t>(unit);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
             auto [new_it, codepoint] = decode(std::move(it), end);
 
             *out = codepoint.value_or(REPLACEMENT);
@@ -76,10 +593,64 @@ namespace utf8 {
         return out;
     }
 
+    // As `decode_all` for [it, end) that must already be known to be valid, such as a `ValidView`. Nothing is
+    // checked, and nothing is replaced.
+    template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char32_t> O>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    constexpr auto decode_unchecked(I it, S end, O out) noexcept -> O {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char32_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::write_bulk<char32_t>(out, input.size(), [&](char32_t* const first) noexcept {
+                    return detail::simd::decode_unchecked(input, first);
+                });
+
+                return out;
+            }
+        }
+
+        while(it != end) {
+            *out = detail::read_valid_sequence(it);
+            ++out;
+        }
+
+        return out;
+    }
+
     template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char32_t> O>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     [[nodiscard]] constexpr auto decode_strict(I it, S end, O out) noexcept -> std::pair<O, Expected<void>> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char32_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                Expected<void> result{};
+
+                detail::write_bulk<char32_t>(out, input.size(), [&](char32_t* const first) noexcept {
+                    const auto strict = detail::simd::decode_strict(input, first);
+
+                    result = strict.result;
+
+                    return strict.written;
+                });
+
+                return { std::move(out), result };
+            }
+        }
+
         while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char8_t unit : run) {
+                    *out = static_cast<char32_t>(unit);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
             auto [new_it, codepoint] = decode(std::move(it), end);
             if(!codepoint) {
                 return { std::move(out), Unexpected{ codepoint.error() } };
@@ -94,10 +665,87 @@ namespace utf8 {
         return { std::move(out), {} };
     }
 
+    // As `decode_strict`, but also reports where in the input the first ill-formed sequence starts.
+    template<std::forward_iterator I, std::sentinel_for<I> S, std::output_iterator<char32_t> O>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto decode_checked(I it, S end, O out) noexcept -> CheckedResult<I, O> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char32_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::simd::Strict strict{};
+
+                detail::write_bulk<char32_t>(out, input.size(), [&](char32_t* const first) noexcept {
+                    strict = detail::simd::decode_strict(input, first);
+
+                    return strict.written;
+                });
+
+                it += static_cast<std::iter_difference_t<I>>(strict.read);
+
+                return { std::move(it), std::move(out), strict.read, strict.result };
+            }
+        }
+
+        std::size_t valid = 0U;
+
+        while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char8_t unit : run) {
+                    *out = static_cast<char32_t>(unit);
+                    ++out;
+                }
+
+                valid += run.size();
+            });
+
+            if(it == end) {
+                break;
+            }
+
+            auto [new_it, codepoint] = decode(it, end);
+            if(!codepoint) {
+                return { std::move(it), std::move(out), valid, Unexpected{ codepoint.error() } };
+            }
+
+            *out = *codepoint;
+            ++out;
+
+            valid += static_cast<std::size_t>(std::ranges::distance(it, new_it));
+
+            it = std::move(new_it);
+        }
+
+        return { std::move(it), std::move(out), valid, {} };
+    }
+
     template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
         requires std::same_as<std::iter_value_t<I>, char32_t>
     constexpr auto encode_all(I it, S end, O out) noexcept -> O {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char8_t>) {
+            if !consteval {
+                const std::span<const char32_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::write_bulk<char8_t>(out, input.size() * 4U, [&](char8_t* const first) noexcept {
+                    return detail::simd::encode_all(input, first);
+                });
+
+                return out;
+            }
+        }
+
         while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char32_t codepoint : run) {
+                    *out = static_cast<char8_t>(codepoint);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
             char32_t codepoint = *it;
             if(is_invalid(codepoint)) {
                 codepoint = REPLACEMENT;
@@ -116,7 +764,36 @@ namespace utf8 {
     template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
         requires std::same_as<std::iter_value_t<I>, char32_t>
     [[nodiscard]] constexpr auto encode_strict(I it, S end, O out) noexcept -> std::pair<O, Expected<void>> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char8_t>) {
+            if !consteval {
+                const std::span<const char32_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                Expected<void> result{};
+
+                detail::write_bulk<char8_t>(out, input.size() * 4U, [&](char8_t* const first) noexcept {
+                    const auto strict = detail::simd::encode_strict(input, first);
+
+                    result = strict.result;
+
+                    return strict.written;
+                });
+
+                return { std::move(out), result };
+            }
+        }
+
         while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char32_t codepoint : run) {
+                    *out = static_cast<char8_t>(codepoint);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
             const auto units = encode(*it);
             if(!units) {
                 return { std::move(out), Unexpected{ units.error() } };
@@ -130,6 +807,312 @@ namespace utf8 {
         return { std::move(out), {} };
     }
 
+    // As `encode_strict`, but also reports which codepoint of the input is the first invalid one.
+    template<std::forward_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
+        requires std::same_as<std::iter_value_t<I>, char32_t>
+    [[nodiscard]] constexpr auto encode_checked(I it, S end, O out) noexcept -> CheckedResult<I, O> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char8_t>) {
+            if !consteval {
+                const std::span<const char32_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::simd::Strict strict{};
+
+                detail::write_bulk<char8_t>(out, input.size() * 4U, [&](char8_t* const first) noexcept {
+                    strict = detail::simd::encode_strict(input, first);
+
+                    return strict.written;
+                });
+
+                it += static_cast<std::iter_difference_t<I>>(strict.read);
+
+                return { std::move(it), std::move(out), strict.read, strict.result };
+            }
+        }
+
+        std::size_t valid = 0U;
+
+        for(; it != end; ++it, ++valid) {
+            const auto units = encode(*it);
+            if(!units) {
+                return { std::move(it), std::move(out), valid, Unexpected{ units.error() } };
+            }
+
+            out = std::ranges::copy(*units, std::move(out)).out;
+        }
+
+        return { std::move(it), std::move(out), valid, {} };
+    }
+
+    // Number of UTF-16 units [it, end) transcodes to.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto utf16_length_from_utf8(I it, S end) noexcept -> Expected<std::size_t> {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::utf16_length({ std::to_address(it), size });
+            }
+        }
+
+        std::size_t result = 0U;
+
+        while(it != end) {
+            auto [new_it, codepoint] = decode(std::move(it), end);
+            if(!codepoint) {
+                return Unexpected{ codepoint.error() };
+            }
+
+            it = std::move(new_it);
+
+            result += *codepoint < detail::SUPPLEMENTARY_FIRST ? 1U : 2U;
+        }
+
+        return result;
+    }
+
+    // Number of codepoints `decode_all` writes for [it, end), replacements included.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto utf32_length_from_utf8(I it, S end) noexcept -> std::size_t {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::decoded_length({ std::to_address(it), size });
+            }
+        }
+
+        std::size_t result = 0U;
+
+        for(; it != end; ++result) {
+            it = decode(std::move(it), end).first;
+        }
+
+        return result;
+    }
+
+    // Number of units `encode_all` writes for [it, end), replacements included.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char32_t>
+    [[nodiscard]] constexpr auto utf8_length_from_utf32(I it, S end) noexcept -> std::size_t {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::encoded_length({ std::to_address(it), size });
+            }
+        }
+
+        std::size_t result = 0U;
+
+        for(; it != end; ++it) {
+            result += encode(*it).value_or(REPLACEMENT_UNITS).size();
+        }
+
+        return result;
+    }
+
+    // Number of units `repair` writes for [it, end).
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto utf8_length_after_repair(I it, S end) noexcept -> std::size_t {
+        if constexpr(detail::contiguous_source<I, S>) {
+            if !consteval {
+                const auto size = static_cast<std::size_t>(end - it);
+
+                return detail::simd::repaired_length({ std::to_address(it), size });
+            }
+        }
+
+        std::size_t result = 0U;
+
+        while(it != end) {
+            auto [new_it, codepoint] = decode(std::move(it), end);
+
+            result += codepoint ? encode(*codepoint)->size() : REPLACEMENT_UNITS.size();
+
+            it = std::move(new_it);
+        }
+
+        return result;
+    }
+
+    // Produces what `repair` writes, but only copies when the input has an error. The valid prefix is found
+    // with the vector validator and copied as one block; only the rest is repaired sequence by sequence.
+    template<std::contiguous_iterator I, std::sized_sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto repair_if_needed(I it, S end) -> Repaired {
+        const std::u8string_view input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+        const std::size_t valid = validate(input.begin(), input.end()).valid;
+        if(valid == input.size()) {
+            return Repaired{ input };
+        }
+
+        // Sized exactly, since the result is kept and a bound on it would be up to 3 times the input.
+        const std::size_t size = valid + utf8::utf8_length_after_repair(input.begin() + valid, input.end());
+
+        std::u8string repaired;
+        repaired.resize_and_overwrite(size, [&](char8_t* const data, std::size_t) noexcept {
+            std::ranges::copy(input.substr(0U, valid), data);
+
+            return static_cast<std::size_t>(repair(input.begin() + valid, input.end(), data + valid) - data);
+        });
+
+        return Repaired{ input, std::move(repaired) };
+    }
+
+    // Transcodes UTF-8 to UTF-16, replacing ill-formed sequences like `decode_all`.
+    template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char16_t> O>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    constexpr auto decode_utf16(I it, S end, O out) noexcept -> O {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char16_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::write_bulk<char16_t>(out, input.size(), [&](char16_t* const first) noexcept {
+                    return detail::simd::decode_utf16(input, first);
+                });
+
+                return out;
+            }
+        }
+
+        while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char8_t unit : run) {
+                    *out = static_cast<char16_t>(unit);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
+            auto [new_it, codepoint] = decode(std::move(it), end);
+
+            out = detail::write_utf16(codepoint.value_or(REPLACEMENT), std::move(out));
+
+            it = std::move(new_it);
+        }
+
+        return out;
+    }
+
+    template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char16_t> O>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto decode_utf16_strict(I it, S end, O out) noexcept -> std::pair<O, Expected<void>> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char16_t>) {
+            if !consteval {
+                const std::span<const char8_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                Expected<void> result{};
+
+                detail::write_bulk<char16_t>(out, input.size(), [&](char16_t* const first) noexcept {
+                    const auto strict = detail::simd::decode_utf16_strict(input, first);
+
+                    result = strict.result;
+
+                    return strict.written;
+                });
+
+                return { std::move(out), result };
+            }
+        }
+
+        while(it != end) {
+            detail::skip_ascii(it, end, [&](const auto run) noexcept -> void {
+                for(const char8_t unit : run) {
+                    *out = static_cast<char16_t>(unit);
+                    ++out;
+                }
+            });
+
+            if(it == end) {
+                break;
+            }
+
+            auto [new_it, codepoint] = decode(std::move(it), end);
+            if(!codepoint) {
+                return { std::move(out), Unexpected{ codepoint.error() } };
+            }
+
+            out = detail::write_utf16(*codepoint, std::move(out));
+
+            it = std::move(new_it);
+        }
+
+        return { std::move(out), {} };
+    }
+
+    // Transcodes UTF-16 to UTF-8, replacing every unpaired surrogate like `encode_all`.
+    template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
+        requires std::same_as<std::iter_value_t<I>, char16_t>
+    constexpr auto encode_utf16(I it, S end, O out) noexcept -> O {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char8_t>) {
+            if !consteval {
+                const std::span<const char16_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                detail::write_bulk<char8_t>(out, input.size() * 3U, [&](char8_t* const first) noexcept {
+                    return detail::simd::encode_utf16(input, first);
+                });
+
+                return out;
+            }
+        }
+
+        while(it != end) {
+            auto [new_it, codepoint] = detail::read_utf16(std::move(it), end);
+
+            const auto units = *encode(codepoint.value_or(REPLACEMENT));
+
+            out = std::ranges::copy(units, std::move(out)).out;
+
+            it = std::move(new_it);
+        }
+
+        return out;
+    }
+
+    template<std::input_iterator I, std::sentinel_for<I> S, std::output_iterator<char8_t> O>
+        requires std::same_as<std::iter_value_t<I>, char16_t>
+    [[nodiscard]] constexpr auto encode_utf16_strict(I it, S end, O out) noexcept -> std::pair<O, Expected<void>> {
+        if constexpr(detail::contiguous_source<I, S> && detail::bulk_output<O, char8_t>) {
+            if !consteval {
+                const std::span<const char16_t> input{ std::to_address(it), static_cast<std::size_t>(end - it) };
+
+                Expected<void> result{};
+
+                detail::write_bulk<char8_t>(out, input.size() * 3U, [&](char8_t* const first) noexcept {
+                    const auto strict = detail::simd::encode_utf16_strict(input, first);
+
+                    result = strict.result;
+
+                    return strict.written;
+                });
+
+                return { std::move(out), result };
+            }
+        }
+
+        while(it != end) {
+            auto [new_it, codepoint] = detail::read_utf16(std::move(it), end);
+            if(!codepoint) {
+                return { std::move(out), Unexpected{ codepoint.error() } };
+            }
+
+            const auto units = *encode(*codepoint);
+
+            out = std::ranges::copy(units, std::move(out)).out;
+
+            it = std::move(new_it);
+        }
+
+        return { std::move(out), {} };
+    }
+
     namespace ranges {
         template<std::ranges::input_range R>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
@@ -137,30 +1120,104 @@ namespace utf8 {
             return utf8::is_valid(std::ranges::begin(range), std::ranges::end(range));
         }
 
+        template<std::ranges::forward_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto validate(R&& range) noexcept -> ValidateResult<std::ranges::borrowed_iterator_t<R>> {
+            return utf8::validate(std::ranges::begin(range), std::ranges::end(range));
+        }
+
         template<std::ranges::input_range R>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
         [[nodiscard]] constexpr auto length(R&& range) noexcept -> Expected<std::size_t> {
             return utf8::length(std::ranges::begin(range), std::ranges::end(range));
         }
 
+        template<std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto length_unchecked(R&& range) noexcept -> std::size_t {
+            return utf8::length_unchecked(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        // These return part of `range`, which must outlive the result unless it is borrowed.
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto truncate_bytes(R&& range, const std::size_t count) noexcept -> std::ranges::borrowed_subrange_t<R> {
+            return utf8::truncate_bytes(std::ranges::begin(range), std::ranges::end(range), count);
+        }
+
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto take_codepoints(R&& range, const std::size_t count) noexcept -> std::ranges::borrowed_subrange_t<R> {
+            return utf8::take_codepoints(std::ranges::begin(range), std::ranges::end(range), count);
+        }
+
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto drop_codepoints(R&& range, const std::size_t count) noexcept -> std::ranges::borrowed_subrange_t<R> {
+            return utf8::drop_codepoints(std::ranges::begin(range), std::ranges::end(range), count);
+        }
+
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto find(R&& range, const char32_t codepoint) noexcept -> std::ranges::borrowed_subrange_t<R> {
+            return utf8::find(std::ranges::begin(range), std::ranges::end(range), codepoint);
+        }
+
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto find_any_of(R&& range, const std::u32string_view set) noexcept -> std::ranges::borrowed_subrange_t<R> {
+            return utf8::find_any_of(std::ranges::begin(range), std::ranges::end(range), set);
+        }
+
         template<std::ranges::input_range R, std::output_iterator<char8_t> O>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
         constexpr auto repair(R&& range, O out) noexcept -> O {
             return utf8::repair(std::ranges::begin(range), std::ranges::end(range), std::move(out));
         }
 
+        // The result may view `range`, which must outlive it.
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::ranges::borrowed_range<R> &&
+                std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto repair_if_needed(R&& range) -> Repaired {
+            return utf8::repair_if_needed(std::ranges::begin(range), std::ranges::end(range));
+        }
+
         template<std::ranges::input_range R, std::output_iterator<char32_t> O>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
         constexpr auto decode_all(R&& range, O out) noexcept -> O {
             return utf8::decode_all(std::ranges::begin(range), std::ranges::end(range), std::move(out));
         }
 
+        // The result views `range`, which must outlive it.
+        template<std::ranges::contiguous_range R>
+            requires std::ranges::sized_range<R> && std::ranges::borrowed_range<R> &&
+                std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto validated(R&& range) noexcept -> Expected<ValidView> {
+            return utf8::validated(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template<std::ranges::input_range R, std::output_iterator<char32_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        constexpr auto decode_unchecked(R&& range, O out) noexcept -> O {
+            return utf8::decode_unchecked(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
         template<std::ranges::input_range R, std::output_iterator<char32_t> O>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
         [[nodiscard]] constexpr auto decode_strict(R&& range, O out) noexcept -> std::pair<O, Expected<void>> {
             return utf8::decode_strict(std::ranges::begin(range), std::ranges::end(range), std::move(out));
         }
 
+        template<std::ranges::forward_range R, std::output_iterator<char32_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto decode_checked(
+            R&& range,
+            O   out
+        ) noexcept -> CheckedResult<std::ranges::borrowed_iterator_t<R>, O> {
+            return utf8::decode_checked(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
         template<std::ranges::input_range R, std::output_iterator<char8_t> O>
             requires std::same_as<std::ranges::range_value_t<R>, char32_t>
         constexpr auto encode_all(R&& range, O out) noexcept -> O {
@@ -172,5 +1229,115 @@ namespace utf8 {
         [[nodiscard]] constexpr auto encode_strict(R&& range, O out) noexcept -> std::pair<O, Expected<void>> {
             return utf8::encode_strict(std::ranges::begin(range), std::ranges::end(range), std::move(out));
         }
+
+        template<std::ranges::forward_range R, std::output_iterator<char8_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char32_t>
+        [[nodiscard]] constexpr auto encode_checked(
+            R&& range,
+            O   out
+        ) noexcept -> CheckedResult<std::ranges::borrowed_iterator_t<R>, O> {
+            return utf8::encode_checked(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
+        template<std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto utf16_length_from_utf8(R&& range) noexcept -> Expected<std::size_t> {
+            return utf8::utf16_length_from_utf8(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template<std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto utf32_length_from_utf8(R&& range) noexcept -> std::size_t {
+            return utf8::utf32_length_from_utf8(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template<std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char32_t>
+        [[nodiscard]] constexpr auto utf8_length_from_utf32(R&& range) noexcept -> std::size_t {
+            return utf8::utf8_length_from_utf32(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template<std::ranges::input_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto utf8_length_after_repair(R&& range) noexcept -> std::size_t {
+            return utf8::utf8_length_after_repair(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        // Owning conversions. The input is measured first, so the result is allocated once at its exact size and
+        // then written by the bulk transcoder.
+        template<std::ranges::forward_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto to_u32string(R&& range) -> std::u32string {
+            std::u32string result;
+            result.resize_and_overwrite(ranges::utf32_length_from_utf8(range), [&](char32_t* const data, std::size_t) noexcept {
+                return static_cast<std::size_t>(ranges::decode_all(range, data) - data);
+            });
+
+            return result;
+        }
+
+        template<std::ranges::forward_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char32_t>
+        [[nodiscard]] constexpr auto to_u8string(R&& range) -> std::u8string {
+            std::u8string result;
+            result.resize_and_overwrite(ranges::utf8_length_from_utf32(range), [&](char8_t* const data, std::size_t) noexcept {
+                return static_cast<std::size_t>(ranges::encode_all(range, data) - data);
+            });
+
+            return result;
+        }
+
+        // As `repair`, but valid runs are found with the validator and copied whole.
+        template<std::ranges::forward_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto repaired(R&& range) -> std::u8string {
+            std::u8string result;
+            result.resize_and_overwrite(ranges::utf8_length_after_repair(range), [&](char8_t* const first, std::size_t) noexcept {
+                auto       it   = std::ranges::begin(range);
+                const auto end  = std::ranges::end(range);
+                char8_t*   data = first;
+
+                while(true) {
+                    auto checked = utf8::validate(it, end);
+
+                    data = std::ranges::copy(std::move(it), checked.in, data).out;
+
+                    if(checked.result) {
+                        break;
+                    }
+
+                    it   = decode(std::move(checked.in), end).first;
+                    data = std::ranges::copy(REPLACEMENT_UNITS, data).out;
+                }
+
+                return static_cast<std::size_t>(data - first);
+            });
+
+            return result;
+        }
+
+        template<std::ranges::input_range R, std::output_iterator<char16_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        constexpr auto decode_utf16(R&& range, O out) noexcept -> O {
+            return utf8::decode_utf16(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
+        template<std::ranges::input_range R, std::output_iterator<char16_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] constexpr auto decode_utf16_strict(R&& range, O out) noexcept -> std::pair<O, Expected<void>> {
+            return utf8::decode_utf16_strict(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
+        template<std::ranges::input_range R, std::output_iterator<char8_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char16_t>
+        constexpr auto encode_utf16(R&& range, O out) noexcept -> O {
+            return utf8::encode_utf16(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
+
+        template<std::ranges::input_range R, std::output_iterator<char8_t> O>
+            requires std::same_as<std::ranges::range_value_t<R>, char16_t>
+        [[nodiscard]] constexpr auto encode_utf16_strict(R&& range, O out) noexcept -> std::pair<O, Expected<void>> {
+            return utf8::encode_utf16_strict(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+        }
     }
 }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace utf8::batch {
+    // Validates many short fields in one pass instead of one call each. Fields are laid out back to back, and
+    // the vector validator runs across them as if they were one text; only the fields around an error, and the
+    // boundaries between fields, are checked on their own.
+    //
+    // Field `i` is [offsets[i], offsets[i + 1]) of `blob`, like the values of an Arrow string column: the offsets
+    // do not decrease, stay within `blob`, and there is one more of them than there are fields.
+    //
+    // `validate` sets bit `i` of `bitmap`, least significant bit first like an Arrow validity bitmap, if field `i`
+    // is valid UTF-8 and clears it otherwise, and returns the number of invalid fields. `bitmap` must hold a bit
+    // per field.
+    auto validate(
+        std::span<const char8_t>      blob,
+        std::span<const std::int32_t> offsets,
+        std::span<std::uint8_t>       bitmap
+    ) noexcept -> std::size_t;
+
+    auto validate(
+        std::span<const char8_t>      blob,
+        std::span<const std::int64_t> offsets,
+        std::span<std::uint8_t>       bitmap
+    ) noexcept -> std::size_t;
+
+    // As above for fields anywhere in memory, which are first gathered back to back.
+    auto validate(std::span<const std::span<const char8_t>> fields, std::span<std::uint8_t> bitmap) noexcept -> std::size_t;
+
+    // Index of the first invalid field, or the number of fields if all of them are valid. Stops at that field.
+    [[nodiscard]] auto first_invalid(std::span<const char8_t> blob, std::span<const std::int32_t> offsets) noexcept -> std::size_t;
+    [[nodiscard]] auto first_invalid(std::span<const char8_t> blob, std::span<const std::int64_t> offsets) noexcept -> std::size_t;
+    [[nodiscard]] auto first_invalid(std::span<const std::span<const char8_t>> fields) noexcept -> std::size_t;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace utf8 {
+    // Maps between codepoint and byte offsets of valid UTF-8 text in O(interval) time. It records the byte offset
+    // of every `interval`-th codepoint, and optionally where every line starts, but does not keep the text
+    // itself: lookups take the text the index was built over, which may have moved since.
+    class OffsetIndex {
+    public:
+        static constexpr std::size_t DEFAULT_INTERVAL = 256U;
+
+        explicit OffsetIndex(std::size_t interval = DEFAULT_INTERVAL, bool track_lines = false);
+
+        // Indexes `text` in one pass, as if it was appended to an empty index.
+        explicit OffsetIndex(std::span<const char8_t> text, std::size_t interval = DEFAULT_INTERVAL, bool track_lines = false);
+
+        // Extends the index by `units`, which follow the text indexed so far. They may split a sequence.
+        auto append(std::span<const char8_t> units) -> void;
+
+        // Number of codepoints and bytes of the indexed text.
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+        [[nodiscard]] auto size_bytes() const noexcept -> std::size_t;
+
+        // Byte offset of codepoint `codepoint` of `text`, or the size of `text` if it is `size()`.
+        [[nodiscard]] auto byte_offset(std::span<const char8_t> text, std::size_t codepoint) const noexcept -> std::size_t;
+
+        // Number of codepoints of `text` starting before byte offset `byte`.
+        [[nodiscard]] auto codepoint_offset(std::span<const char8_t> text, std::size_t byte) const noexcept -> std::size_t;
+
+        // Lines end after each U+000A and are only tracked if requested; otherwise there is a single line.
+        [[nodiscard]] auto line_count() const noexcept -> std::size_t;
+        [[nodiscard]] auto line_start(std::size_t line) const noexcept -> std::size_t;
+        [[nodiscard]] auto line_of(std::size_t byte) const noexcept -> std::size_t;
+
+    private:
+        std::size_t              m_interval;
+        bool                     m_track_lines;
+        std::size_t              m_size{};
+        std::size_t              m_size_bytes{};
+        std::vector<std::size_t> m_samples;
+        std::vector<std::size_t> m_lines{ 0U };
+    };
+}
@@ -1,14 +1,30 @@
 #pragma once
 
+#include "algorithm.hpp"
 #include "validation.hpp"
 
+#include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <span>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
 namespace utf8 {
+    namespace detail {
+        struct Unused {};
+
+        // Where a bidirectional iterator keeps a position of its base, which other iterators do not need.
+        template<typename I>
+        using BidirectionalOnly = std::conditional_t<std::bidirectional_iterator<I>, I, Unused>;
+    }
+
+    // Bidirectional over a bidirectional base: it then also remembers the start of the base and of the current
+    // codepoint, and steps back with `decode_prev`.
     template<std::input_iterator I, std::sentinel_for<I> S>
         requires std::same_as<std::iter_value_t<I>, char8_t>
     class Iterator {
@@ -17,9 +33,13 @@ namespace utf8 {
     public:
         using iterator_category = std::input_iterator_tag;
         using iterator_concept  = std::conditional_t<
-            std::forward_iterator<I>,
-            std::forward_iterator_tag,
-            std::input_iterator_tag
+            std::bidirectional_iterator<I>,
+            std::bidirectional_iterator_tag,
+            std::conditional_t<
+                std::forward_iterator<I>,
+                std::forward_iterator_tag,
+                std::input_iterator_tag
+            >
         >;
 
         using value_type      = char32_t;
@@ -31,6 +51,10 @@ namespace utf8 {
 
         explicit constexpr Iterator(I it, S end) noexcept
             : m_it{ std::move(it) }, m_end{ std::move(end) } {
+            if constexpr(std::bidirectional_iterator<I>) {
+                m_begin = m_it;
+            }
+
             next();
 
             if(m_codepoint == BOM) {
@@ -38,6 +62,11 @@ namespace utf8 {
             }
         }
 
+        // The past-the-end iterator of [begin, end), which can be stepped back from.
+        constexpr Iterator(I begin, I end, std::default_sentinel_t) noexcept
+            requires std::bidirectional_iterator<I> && std::same_as<I, S>
+            : m_it{ end }, m_end{ end }, m_codepoint{ END_OF_STREAM }, m_begin{ std::move(begin) }, m_current{ end } {}
+
         [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
             return m_codepoint;
         }
@@ -77,6 +106,22 @@ namespace utf8 {
             }
         }
 
+        constexpr auto operator--() noexcept -> Iterator&
+            requires std::bidirectional_iterator<I> {
+            prev();
+
+            return *this;
+        }
+
+        constexpr auto operator--(int) noexcept -> Iterator
+            requires std::bidirectional_iterator<I> {
+            const auto copy = *this;
+
+            prev();
+
+            return copy;
+        }
+
         [[nodiscard]] friend constexpr auto operator==(const Iterator lhs, const Iterator rhs) noexcept -> bool {
             return lhs.m_it == rhs.m_it && lhs.m_codepoint == rhs.m_codepoint;
         }
@@ -90,7 +135,14 @@ namespace utf8 {
         S          m_end{};
         value_type m_codepoint{};
 
+        [[no_unique_address]] detail::BidirectionalOnly<I> m_begin{};
+        [[no_unique_address]] detail::BidirectionalOnly<I> m_current{};
+
         auto next() noexcept -> void {
+            if constexpr(std::bidirectional_iterator<I>) {
+                m_current = m_it;
+            }
+
             if(m_it == m_end) {
                 m_codepoint = END_OF_STREAM;
                 return;
@@ -101,6 +153,144 @@ namespace utf8 {
             m_it        = std::move(it);
             m_codepoint = codepoint.value_or(REPLACEMENT);
         }
+
+        auto prev() noexcept -> void {
+            auto [it, codepoint] = decode_prev(m_begin, m_current);
+
+            m_it        = std::exchange(m_current, std::move(it));
+            m_codepoint = codepoint.value_or(REPLACEMENT);
+        }
+    };
+
+    template<std::bidirectional_iterator I>
+    Iterator(I, I, std::default_sentinel_t) -> Iterator<I, I>;
+
+    // Decodes contiguous input a block at a time with the bulk decoder and yields codepoints from the block, with
+    // the same results as `Iterator`. Blocks after the first start at fixed offsets, each moved past at most 3
+    // continuation units, so they decode independently and iterators compare by block and index. Stepping back
+    // past the start of a block loads the one before it. `Trusted` input is known to be valid and is decoded
+    // without being checked.
+    template<bool Trusted = false>
+    class BlockIterator {
+        static constexpr std::size_t BLOCK_SIZE = 64U;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::bidirectional_iterator_tag;
+
+        using value_type      = char32_t;
+        using reference       = char32_t;
+        using pointer         = void;
+        using difference_type = std::ptrdiff_t;
+
+        BlockIterator() = default;
+
+        explicit constexpr BlockIterator(const std::span<const char8_t> input) noexcept
+            : m_input{ input } {
+            load(0U);
+
+            if(m_size != 0U && m_codepoints[0U] == BOM) {
+                ++*this;
+            }
+        }
+
+        // The past-the-end iterator: positioned at the first block that decodes to nothing.
+        constexpr BlockIterator(const std::span<const char8_t> input, std::default_sentinel_t) noexcept
+            : m_input{ input } {
+            const auto size = m_input.size();
+            const auto last = size / BLOCK_SIZE * BLOCK_SIZE;
+
+            if(size == 0U) {
+                m_block = 0U;
+            } else if(last != 0U && boundary(last) == size) {
+                m_block = last;
+            } else {
+                m_block = last + BLOCK_SIZE;
+            }
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return m_codepoints[m_index];
+        }
+
+        constexpr auto operator++() noexcept -> BlockIterator& {
+            if(++m_index == m_size) {
+                load(m_block + BLOCK_SIZE);
+            }
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> BlockIterator {
+            const auto copy = *this;
+
+            ++*this;
+
+            return copy;
+        }
+
+        constexpr auto operator--() noexcept -> BlockIterator& {
+            if(m_index == 0U) {
+                load(m_block - BLOCK_SIZE);
+
+                m_index = m_size;
+            }
+
+            --m_index;
+
+            return *this;
+        }
+
+        constexpr auto operator--(int) noexcept -> BlockIterator {
+            const auto copy = *this;
+
+            --*this;
+
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const BlockIterator& lhs, const BlockIterator& rhs) noexcept -> bool {
+            return lhs.m_block == rhs.m_block && lhs.m_index == rhs.m_index;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const BlockIterator& it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_size == 0U;
+        }
+
+    private:
+        std::span<const char8_t>              m_input{};
+        std::size_t                           m_block{};
+        std::array<char32_t, BLOCK_SIZE + 3U> m_codepoints{};
+        std::uint8_t                          m_size{};
+        std::uint8_t                          m_index{};
+
+        [[nodiscard]] constexpr auto boundary(std::size_t offset) const noexcept -> std::size_t {
+            offset = std::min(offset, m_input.size());
+
+            for(std::size_t i = 0U; i < 3U && offset < m_input.size(); ++i, ++offset) {
+                if((m_input[offset] & ~detail::CONTINUATION_UNIT_MASK) != detail::CONTINUATION_UNIT_HEADER) {
+                    break;
+                }
+            }
+
+            return offset;
+        }
+
+        constexpr auto load(const std::size_t block) noexcept -> void {
+            const auto first = block == 0U ? 0U : boundary(block);
+            const auto last  = boundary(block + BLOCK_SIZE);
+
+            char32_t* out;
+            if constexpr(Trusted) {
+                out = decode_unchecked(m_input.begin() + first, m_input.begin() + last, m_codepoints.data());
+            } else {
+                out = decode_all(m_input.begin() + first, m_input.begin() + last, m_codepoints.data());
+            }
+
+            m_block = block;
+            m_size  = static_cast<std::uint8_t>(out - m_codepoints.data());
+            m_index = 0U;
+        }
     };
 
     template<std::input_iterator I, std::sentinel_for<I> S>
@@ -219,4 +409,404 @@ namespace utf8 {
             }
         }
     };
+
+    // Yields the units `SanIterator` yields for contiguous input as segments: maximal valid runs of the input itself,
+    // found with the vector validator, and `REPLACEMENT_UNITS` for each ill-formed sequence between them. Valid
+    // input is a single segment. A leading BOM is skipped.
+    class SegmentIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::forward_iterator_tag;
+
+        using value_type      = std::span<const char8_t>;
+        using reference       = std::span<const char8_t>;
+        using pointer         = void;
+        using difference_type = std::ptrdiff_t;
+
+        SegmentIterator() = default;
+
+        explicit constexpr SegmentIterator(const std::span<const char8_t> input) noexcept
+            : m_rest{ input } {
+            if(m_rest.size() >= BOM_UNITS.size() && std::ranges::equal(m_rest.first(BOM_UNITS.size()), BOM_UNITS)) {
+                m_rest = m_rest.subspan(BOM_UNITS.size());
+            }
+
+            next();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return m_segment;
+        }
+
+        constexpr auto operator++() noexcept -> SegmentIterator& {
+            next();
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> SegmentIterator {
+            const auto copy = *this;
+
+            next();
+
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const SegmentIterator& lhs, const SegmentIterator& rhs) noexcept -> bool {
+            return lhs.m_rest.data() == rhs.m_rest.data() && lhs.m_segment.size() == rhs.m_segment.size();
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const SegmentIterator& it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_segment.empty();
+        }
+
+    private:
+        std::span<const char8_t> m_rest{};
+        std::span<const char8_t> m_segment{};
+
+        constexpr auto next() noexcept -> void {
+            if(m_rest.empty()) {
+                m_segment = {};
+                return;
+            }
+
+            const auto valid = validate(m_rest.begin(), m_rest.end()).valid;
+            if(valid != 0U) {
+                m_segment = m_rest.first(valid);
+                m_rest    = m_rest.subspan(valid);
+                return;
+            }
+
+            const auto [it, codepoint] = decode(m_rest.begin(), m_rest.end());
+
+            m_segment = std::span<const char8_t>{ REPLACEMENT_UNITS.begin(), REPLACEMENT_UNITS.end() };
+            m_rest    = m_rest.subspan(static_cast<std::size_t>(it - m_rest.begin()));
+        }
+    };
+
+    // Yields the units of the segments of a `SegmentIterator` one at a time, straight from the input.
+    class SegmentedSanIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::forward_iterator_tag;
+
+        using value_type      = char8_t;
+        using reference       = char8_t;
+        using pointer         = void;
+        using difference_type = std::ptrdiff_t;
+
+        SegmentedSanIterator() = default;
+
+        explicit constexpr SegmentedSanIterator(const std::span<const char8_t> input) noexcept
+            : m_segments{ input } {}
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return (*m_segments)[m_index];
+        }
+
+        constexpr auto operator++() noexcept -> SegmentedSanIterator& {
+            if(++m_index == (*m_segments).size()) {
+                ++m_segments;
+
+                m_index = 0U;
+            }
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> SegmentedSanIterator {
+            const auto copy = *this;
+
+            ++*this;
+
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(
+            const SegmentedSanIterator& lhs,
+            const SegmentedSanIterator& rhs
+        ) noexcept -> bool {
+            return lhs.m_segments == rhs.m_segments && lhs.m_index == rhs.m_index;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const SegmentedSanIterator& it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_segments == std::default_sentinel;
+        }
+
+    private:
+        SegmentIterator m_segments{};
+        std::size_t     m_index{};
+    };
+
+    // Yields the pieces of contiguous input between occurrences of an encoded delimiter, as views of the input,
+    // like `std::views::split`: empty input has no pieces, and a delimiter at either end starts or ends an empty
+    // one. An invalid delimiter, encoded as no units, never occurs.
+    class SplitIterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::forward_iterator_tag;
+
+        using value_type      = std::u8string_view;
+        using reference       = std::u8string_view;
+        using pointer         = void;
+        using difference_type = std::ptrdiff_t;
+
+        SplitIterator() = default;
+
+        constexpr SplitIterator(const std::span<const char8_t> input, const Encode& delimiter) noexcept
+            : m_rest{ input }
+            , m_delimiter{ delimiter }
+            , m_done{ input.empty() } {
+            next();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return m_piece;
+        }
+
+        constexpr auto operator++() noexcept -> SplitIterator& {
+            next();
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> SplitIterator {
+            const auto copy = *this;
+
+            next();
+
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const SplitIterator& lhs, const SplitIterator& rhs) noexcept -> bool {
+            return lhs.m_done == rhs.m_done && (lhs.m_done || lhs.m_piece.data() == rhs.m_piece.data());
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const SplitIterator& it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_done;
+        }
+
+    private:
+        std::span<const char8_t> m_rest{};
+        std::u8string_view       m_piece{};
+        Encode                   m_delimiter{};
+        bool                     m_last = false;
+        bool                     m_done = true;
+
+        constexpr auto next() noexcept -> void {
+            if(m_last) {
+                m_done = true;
+                return;
+            }
+
+            if(m_done) {
+                return;
+            }
+
+            const std::span<const char8_t> needle{ m_delimiter.begin(), m_delimiter.end() };
+
+            const auto offset = needle.empty() ? m_rest.size() : detail::find_units(m_rest, needle);
+
+            m_piece = { m_rest.data(), offset };
+
+            if(offset == m_rest.size()) {
+                m_last = true;
+                return;
+            }
+
+            m_rest = m_rest.subspan(offset + needle.size());
+        }
+    };
+
+    // Yields the UTF-16 units of UTF-8 input, replacing ill-formed sequences.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    class DecodeUtf16Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::conditional_t<
+            std::forward_iterator<I>,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >;
+
+        using value_type      = char16_t;
+        using reference       = char16_t;
+        using pointer         = void;
+        using difference_type = std::iter_difference_t<I>;
+
+        DecodeUtf16Iterator() = default;
+
+        explicit constexpr DecodeUtf16Iterator(I it, S end) noexcept
+            : m_it{ std::move(it) }, m_end{ std::move(end) } {
+            next();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return m_units[m_index];
+        }
+
+        constexpr auto operator++() noexcept -> DecodeUtf16Iterator& {
+            if(++m_index == m_length) {
+                next();
+            }
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept {
+            if constexpr(std::forward_iterator<I>) {
+                const auto copy = *this;
+
+                ++*this;
+
+                return copy;
+            } else {
+                class Proxy {
+                public:
+                    explicit constexpr Proxy(const value_type unit) noexcept
+                        : m_unit{ unit } {}
+
+                    [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                        return m_unit;
+                    }
+
+                private:
+                    value_type m_unit;
+                };
+
+                const Proxy proxy{ m_units[m_index] };
+
+                ++*this;
+
+                return proxy;
+            }
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const DecodeUtf16Iterator lhs, const DecodeUtf16Iterator rhs) noexcept -> bool {
+            return lhs.m_it == rhs.m_it && lhs.m_index == rhs.m_index && lhs.m_length == rhs.m_length;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const DecodeUtf16Iterator it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_length == 0U;
+        }
+
+    private:
+        I                        m_it{};
+        S                        m_end{};
+        std::array<char16_t, 2U> m_units{};
+        std::uint8_t             m_length{};
+        std::uint8_t             m_index{};
+
+        auto next() noexcept -> void {
+            m_index = 0U;
+
+            if(m_it == m_end) {
+                m_length = 0U;
+                return;
+            }
+
+            auto [it, codepoint] = decode(std::move(m_it), m_end);
+
+            m_it = std::move(it);
+
+            const auto last = detail::write_utf16(codepoint.value_or(REPLACEMENT), m_units.begin());
+
+            m_length = static_cast<std::uint8_t>(last - m_units.begin());
+        }
+    };
+
+    // Yields the UTF-8 units of UTF-16 input, replacing unpaired surrogates.
+    template<std::input_iterator I, std::sentinel_for<I> S>
+        requires std::same_as<std::iter_value_t<I>, char16_t>
+    class EncodeUtf16Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::conditional_t<
+            std::forward_iterator<I>,
+            std::forward_iterator_tag,
+            std::input_iterator_tag
+        >;
+
+        using value_type      = char8_t;
+        using reference       = char8_t;
+        using pointer         = void;
+        using difference_type = std::iter_difference_t<I>;
+
+        EncodeUtf16Iterator() = default;
+
+        explicit constexpr EncodeUtf16Iterator(I it, S end) noexcept
+            : m_it{ std::move(it) }, m_end{ std::move(end) } {
+            next();
+        }
+
+        [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+            return m_units.units[m_index];
+        }
+
+        constexpr auto operator++() noexcept -> EncodeUtf16Iterator& {
+            if(++m_index == m_units.length) {
+                next();
+            }
+
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept {
+            if constexpr(std::forward_iterator<I>) {
+                const auto copy = *this;
+
+                ++*this;
+
+                return copy;
+            } else {
+                class Proxy {
+                public:
+                    explicit constexpr Proxy(const value_type unit) noexcept
+                        : m_unit{ unit } {}
+
+                    [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                        return m_unit;
+                    }
+
+                private:
+                    value_type m_unit;
+                };
+
+                const Proxy proxy{ m_units.units[m_index] };
+
+                ++*this;
+
+                return proxy;
+            }
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const EncodeUtf16Iterator lhs, const EncodeUtf16Iterator rhs) noexcept -> bool {
+            return lhs.m_it == rhs.m_it && lhs.m_index == rhs.m_index && lhs.m_units.length == rhs.m_units.length;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const EncodeUtf16Iterator it, std::default_sentinel_t) noexcept -> bool {
+            return it.m_units.length == 0U;
+        }
+
+    private:
+        I            m_it{};
+        S            m_end{};
+        Encode       m_units{};
+        std::uint8_t m_index{};
+
+        auto next() noexcept -> void {
+            m_index = 0U;
+
+            if(m_it == m_end) {
+                m_units.length = 0U;
+                return;
+            }
+
+            auto [it, codepoint] = detail::read_utf16(std::move(m_it), m_end);
+
+            m_it    = std::move(it);
+            m_units = *encode(codepoint.value_or(REPLACEMENT));
+        }
+    };
 }
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "algorithm.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace utf8 {
+    // The units of a string literal, held by value so that it can be a template argument. Ordinary literals are
+    // taken to be UTF-8, like `u8` ones. The terminating null is dropped.
+    template<std::size_t N>
+    struct FixedString {
+        std::array<char8_t, N - 1U> units{};
+
+        template<typename C>
+            requires std::same_as<C, char> || std::same_as<C, char8_t>
+        consteval FixedString(const C (&literal)[N]) noexcept {
+            for(std::size_t i = 0U; i < N - 1U; ++i) {
+                units[i] = static_cast<char8_t>(literal[i]);
+            }
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const char8_t* {
+            return units.data();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const char8_t* {
+            return units.data() + units.size();
+        }
+    };
+
+    template<FixedString S>
+    concept valid_literal = utf8::is_valid(S.begin(), S.end());
+
+    // UTF-8 text validated during compilation: naming it with ill-formed units is ill-formed. Its codepoint count,
+    // and its codepoints if they are asked for, are computed during compilation too, so nothing is left to check
+    // or decode at run time.
+    template<FixedString S>
+        requires valid_literal<S>
+    class Literal {
+    public:
+        // Number of codepoints.
+        static constexpr std::size_t LENGTH = utf8::length_unchecked(S.begin(), S.end());
+
+        [[nodiscard]] static constexpr auto view() noexcept -> std::u8string_view {
+            return { S.begin(), S.end() };
+        }
+
+        [[nodiscard]] static constexpr auto data() noexcept -> const char8_t* {
+            return S.begin();
+        }
+
+        [[nodiscard]] static constexpr auto size() noexcept -> std::size_t {
+            return S.units.size();
+        }
+
+        [[nodiscard]] static constexpr auto length() noexcept -> std::size_t {
+            return LENGTH;
+        }
+
+        [[nodiscard]] static constexpr auto begin() noexcept -> const char8_t* {
+            return S.begin();
+        }
+
+        [[nodiscard]] static constexpr auto end() noexcept -> const char8_t* {
+            return S.end();
+        }
+
+        // The decoded codepoints, which are only computed, and stored, if this is used.
+        [[nodiscard]] static constexpr auto codepoints() noexcept -> std::span<const char32_t, LENGTH> {
+            return CODEPOINTS;
+        }
+
+        constexpr operator std::u8string_view() const noexcept {
+            return view();
+        }
+
+    private:
+        static constexpr std::array<char32_t, LENGTH> CODEPOINTS = [] {
+            std::array<char32_t, LENGTH> result{};
+            utf8::decode_all(S.begin(), S.end(), result.data());
+
+            return result;
+        }();
+    };
+
+    template<FixedString S>
+    inline constexpr Literal<S> literal{};
+
+    namespace literals {
+        // `u8"..."_utf8` is `literal<u8"...">`.
+        template<FixedString S>
+        [[nodiscard]] consteval auto operator""_utf8() noexcept -> Literal<S> {
+            return {};
+        }
+    }
+}
+
+template<utf8::FixedString S>
+inline constexpr bool std::ranges::enable_borrowed_range<utf8::Literal<S>> = true;
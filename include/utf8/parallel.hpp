@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace utf8::parallel {
+    // Validates `input` on up to `thread_count` threads, or one per hardware thread if it is zero. Inputs too
+    // small to be worth splitting are validated on the calling thread. Always agrees with `utf8::is_valid`.
+    [[nodiscard]] auto is_valid(std::span<const char8_t> input, std::size_t thread_count = 0U) -> bool;
+
+    // Decodes `input` like `utf8::decode_all` on up to `thread_count` threads. Each thread first counts the
+    // codepoints of its chunk, then decodes it straight into its place in the result.
+    [[nodiscard]] auto decode_all(std::span<const char8_t> input, std::size_t thread_count = 0U) -> std::u32string;
+}
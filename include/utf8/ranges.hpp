@@ -4,6 +4,7 @@
 
 #include <concepts>
 #include <ranges>
+#include <span>
 #include <utility>
 
 namespace utf8::ranges {
@@ -25,22 +26,66 @@ namespace utf8::ranges {
             return std::move(m_view);
         }
 
+        // Contiguous input is decoded a block at a time with the bulk decoder.
         [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
-            return Iterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+            if constexpr(is_blocked) {
+                return BlockIterator{ self.input() };
+            } else {
+                return Iterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+            }
         }
 
-        [[nodiscard]] static constexpr auto end() noexcept {
-            return std::default_sentinel_t{};
+        // Over a bidirectional base with a common end the view is common as well, so it can be walked backwards
+        // from its end without decoding forward first.
+        [[nodiscard]] constexpr auto end(this auto&& self) noexcept {
+            if constexpr(is_blocked) {
+                return BlockIterator{ self.input(), std::default_sentinel };
+            } else if constexpr(std::ranges::bidirectional_range<V> && std::ranges::common_range<V>) {
+                return Iterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view), std::default_sentinel };
+            } else {
+                return std::default_sentinel_t{};
+            }
         }
 
     private:
+        static constexpr bool is_blocked = std::ranges::contiguous_range<V> && std::ranges::sized_range<V>;
+
         V m_view{};
+
+        [[nodiscard]] constexpr auto input(this auto&& self) noexcept -> std::span<const char8_t> {
+            return { std::ranges::data(self.m_view), std::ranges::size(self.m_view) };
+        }
     };
 
     template<std::ranges::viewable_range R>
         requires std::same_as<std::ranges::range_value_t<R>, char8_t>
     DecodeView(R&&) -> DecodeView<std::views::all_t<R>>;
 
+    // Units known to be valid are decoded without being checked.
+    template<>
+    class DecodeView<ValidView> : public std::ranges::view_interface<DecodeView<ValidView>> {
+    public:
+        DecodeView() = default;
+
+        explicit constexpr DecodeView(const ValidView view) noexcept
+            : m_view{ view } {}
+
+        [[nodiscard]] constexpr auto base() const noexcept -> ValidView {
+            return m_view;
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept {
+            return BlockIterator<true>{ m_view };
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept {
+            return BlockIterator<true>{ m_view, std::default_sentinel };
+        }
+
+    private:
+        ValidView m_view{};
+    };
+
     struct Decode : std::ranges::range_adaptor_closure<Decode> {
         template<std::ranges::viewable_range R>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
@@ -51,7 +96,7 @@ namespace utf8::ranges {
 
     template<std::ranges::view V>
         requires std::same_as<std::ranges::range_value_t<V>, char8_t>
-    class SanitizeView : public std::ranges::view_interface<DecodeView<V>> {
+    class SanitizeView : public std::ranges::view_interface<SanitizeView<V>> {
     public:
         SanitizeView() = default;
 
@@ -67,8 +112,13 @@ namespace utf8::ranges {
             return std::move(m_view);
         }
 
+        // Contiguous input is copied run by run from its maximal valid segments.
         [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
-            return SanIterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+            if constexpr(std::ranges::contiguous_range<V> && std::ranges::sized_range<V>) {
+                return SegmentedSanIterator{ std::span<const char8_t>{ self.m_view } };
+            } else {
+                return SanIterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+            }
         }
 
         [[nodiscard]] static constexpr auto end() noexcept {
@@ -91,6 +141,53 @@ namespace utf8::ranges {
         }
     };
 
+    // The output of `SanitizeView` over contiguous input as a range of segments, each a span of either the input or
+    // `REPLACEMENT_UNITS`, which can be written out whole.
+    template<std::ranges::view V>
+        requires std::ranges::contiguous_range<V> && std::ranges::sized_range<V> &&
+            std::same_as<std::ranges::range_value_t<V>, char8_t>
+    class SanitizeSegmentsView : public std::ranges::view_interface<SanitizeSegmentsView<V>> {
+    public:
+        SanitizeSegmentsView() = default;
+
+        explicit constexpr SanitizeSegmentsView(V view) noexcept
+            : m_view{ std::move(view) } {}
+
+        [[nodiscard]] constexpr V base() const & noexcept
+            requires std::copy_constructible<V> {
+            return m_view;
+        }
+
+        [[nodiscard]] constexpr auto base() && noexcept -> V {
+            return std::move(m_view);
+        }
+
+        [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
+            return SegmentIterator{ std::span<const char8_t>{ self.m_view } };
+        }
+
+        [[nodiscard]] static constexpr auto end() noexcept {
+            return std::default_sentinel_t{};
+        }
+
+    private:
+        V m_view{};
+    };
+
+    template<std::ranges::viewable_range R>
+        requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+            std::same_as<std::ranges::range_value_t<R>, char8_t>
+    SanitizeSegmentsView(R&&) -> SanitizeSegmentsView<std::views::all_t<R>>;
+
+    struct SanitizeSegments : std::ranges::range_adaptor_closure<SanitizeSegments> {
+        template<std::ranges::viewable_range R>
+            requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] static constexpr auto operator()(R&& range) noexcept {
+            return SanitizeSegmentsView{ std::forward<R>(range) };
+        }
+    };
+
     struct AsChars : std::ranges::range_adaptor_closure<AsChars> {
         template<std::ranges::viewable_range R>
             requires std::same_as<std::ranges::range_value_t<R>, char8_t>
@@ -115,10 +212,166 @@ namespace utf8::ranges {
         }
     };
 
+    template<std::ranges::view V>
+        requires std::same_as<std::ranges::range_value_t<V>, char8_t>
+    class DecodeUtf16View : public std::ranges::view_interface<DecodeUtf16View<V>> {
+    public:
+        DecodeUtf16View() = default;
+
+        explicit constexpr DecodeUtf16View(V view) noexcept
+            : m_view{ std::move(view) } {}
+
+        [[nodiscard]] constexpr V base() const & noexcept
+            requires std::copy_constructible<V> {
+            return m_view;
+        }
+
+        [[nodiscard]] constexpr auto base() && noexcept -> V {
+            return std::move(m_view);
+        }
+
+        [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
+            return DecodeUtf16Iterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+        }
+
+        [[nodiscard]] static constexpr auto end() noexcept {
+            return std::default_sentinel_t{};
+        }
+
+    private:
+        V m_view{};
+    };
+
+    template<std::ranges::viewable_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+    DecodeUtf16View(R&&) -> DecodeUtf16View<std::views::all_t<R>>;
+
+    struct DecodeUtf16 : std::ranges::range_adaptor_closure<DecodeUtf16> {
+        template<std::ranges::viewable_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] static constexpr auto operator()(R&& range) noexcept {
+            return DecodeUtf16View{ std::forward<R>(range) };
+        }
+    };
+
+    template<std::ranges::view V>
+        requires std::same_as<std::ranges::range_value_t<V>, char16_t>
+    class EncodeUtf16View : public std::ranges::view_interface<EncodeUtf16View<V>> {
+    public:
+        EncodeUtf16View() = default;
+
+        explicit constexpr EncodeUtf16View(V view) noexcept
+            : m_view{ std::move(view) } {}
+
+        [[nodiscard]] constexpr V base() const & noexcept
+            requires std::copy_constructible<V> {
+            return m_view;
+        }
+
+        [[nodiscard]] constexpr auto base() && noexcept -> V {
+            return std::move(m_view);
+        }
+
+        [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
+            return EncodeUtf16Iterator{ std::ranges::begin(self.m_view), std::ranges::end(self.m_view) };
+        }
+
+        [[nodiscard]] static constexpr auto end() noexcept {
+            return std::default_sentinel_t{};
+        }
+
+    private:
+        V m_view{};
+    };
+
+    template<std::ranges::viewable_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, char16_t>
+    EncodeUtf16View(R&&) -> EncodeUtf16View<std::views::all_t<R>>;
+
+    struct EncodeUtf16 : std::ranges::range_adaptor_closure<EncodeUtf16> {
+        template<std::ranges::viewable_range R>
+            requires std::same_as<std::ranges::range_value_t<R>, char16_t>
+        [[nodiscard]] static constexpr auto operator()(R&& range) noexcept {
+            return EncodeUtf16View{ std::forward<R>(range) };
+        }
+    };
+
+    // The pieces of contiguous input between occurrences of a codepoint, as views of the input. The delimiter is
+    // encoded once and its units searched for, so the input is not decoded.
+    template<std::ranges::view V>
+        requires std::ranges::contiguous_range<V> && std::ranges::sized_range<V> &&
+            std::same_as<std::ranges::range_value_t<V>, char8_t>
+    class SplitOnView : public std::ranges::view_interface<SplitOnView<V>> {
+    public:
+        SplitOnView() = default;
+
+        constexpr SplitOnView(V view, const char32_t delimiter) noexcept
+            : m_view{ std::move(view) }
+            , m_delimiter{ encode(delimiter).value_or(Encode{}) } {}
+
+        [[nodiscard]] constexpr V base() const & noexcept
+            requires std::copy_constructible<V> {
+            return m_view;
+        }
+
+        [[nodiscard]] constexpr auto base() && noexcept -> V {
+            return std::move(m_view);
+        }
+
+        [[nodiscard]] constexpr auto begin(this auto&& self) noexcept {
+            return SplitIterator{ std::span<const char8_t>{ self.m_view }, self.m_delimiter };
+        }
+
+        [[nodiscard]] static constexpr auto end() noexcept {
+            return std::default_sentinel_t{};
+        }
+
+    private:
+        V      m_view{};
+        Encode m_delimiter{};
+    };
+
+    template<std::ranges::viewable_range R>
+        requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+            std::same_as<std::ranges::range_value_t<R>, char8_t>
+    SplitOnView(R&&, char32_t) -> SplitOnView<std::views::all_t<R>>;
+
+    struct SplitOn {
+        // `split_on(delimiter)`, to be applied with `|`.
+        struct Closure : std::ranges::range_adaptor_closure<Closure> {
+            char32_t delimiter;
+
+            template<std::ranges::viewable_range R>
+                requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                    std::same_as<std::ranges::range_value_t<R>, char8_t>
+            [[nodiscard]] constexpr auto operator()(R&& range) const noexcept {
+                return SplitOnView{ std::forward<R>(range), delimiter };
+            }
+        };
+
+        template<std::ranges::viewable_range R>
+            requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                std::same_as<std::ranges::range_value_t<R>, char8_t>
+        [[nodiscard]] static constexpr auto operator()(R&& range, const char32_t delimiter) noexcept {
+            return SplitOnView{ std::forward<R>(range), delimiter };
+        }
+
+        [[nodiscard]] static constexpr auto operator()(const char32_t delimiter) noexcept -> Closure {
+            return Closure{ .delimiter = delimiter };
+        }
+    };
+
     namespace views {
         inline constexpr Decode   decode{};
         inline constexpr Sanitize sanitize{};
 
+        inline constexpr SanitizeSegments sanitize_segments{};
+
+        inline constexpr SplitOn split_on{};
+
+        inline constexpr DecodeUtf16 decode_utf16{};
+        inline constexpr EncodeUtf16 encode_utf16{};
+
         inline constexpr AsChars   as_chars{};
         inline constexpr AsU8Chars as_u8chars{};
     }
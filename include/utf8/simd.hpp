@@ -0,0 +1,148 @@
+#pragma once
+
+#include "error.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace utf8 {
+    enum class Isa {
+        Fallback,
+        Sse42,
+        Avx2,
+        Avx512,
+    };
+
+    // Instruction set of the kernels the library currently dispatches to.
+    [[nodiscard]] auto active_isa() noexcept -> Isa;
+
+    // Most capable instruction set that is both compiled in and supported by the running CPU.
+    [[nodiscard]] auto best_isa() noexcept -> Isa;
+
+    [[nodiscard]] auto is_supported(Isa isa) noexcept -> bool;
+
+    // Pins dispatch to `isa`, mainly for testing. Returns false and leaves dispatch unchanged if it is unsupported.
+    auto force_isa(Isa isa) noexcept -> bool;
+}
+
+namespace utf8::detail::simd {
+    // First unit of [it, end) that is not ASCII, testing 32 and then 8 bytes at a time.
+    [[nodiscard]] inline auto skip_ascii(const char8_t* it, const char8_t* const end) noexcept -> const char8_t* {
+        constexpr std::uint64_t HIGH_BITS = 0x8080808080808080U;
+
+        if(it != end && *it >= 0x80U) {
+            return it;
+        }
+
+        for(; end - it >= 32; it += 32) {
+            std::array<std::uint64_t, 4U> words;
+            std::memcpy(words.data(), it, sizeof(words));
+
+            if(((words[0U] | words[1U] | words[2U] | words[3U]) & HIGH_BITS) != 0U) {
+                break;
+            }
+        }
+
+        for(; end - it >= 8; it += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, it, sizeof(word));
+
+            if(const auto high = word & HIGH_BITS; high != 0U) {
+                if constexpr(std::endian::native == std::endian::little) {
+                    return it + std::countr_zero(high) / 8;
+                } else {
+                    return it + std::countl_zero(high) / 8;
+                }
+            }
+        }
+
+        while(it != end && *it < 0x80U) {
+            ++it;
+        }
+
+        return it;
+    }
+
+    [[nodiscard]] inline auto skip_ascii(const char32_t* it, const char32_t* const end) noexcept -> const char32_t* {
+        for(; end - it >= 8; it += 8) {
+            char32_t any = 0U;
+            for(std::size_t i = 0U; i < 8U; ++i) {
+                any |= it[i];
+            }
+
+            if(any >= 0x80U) {
+                break;
+            }
+        }
+
+        while(it != end && *it < 0x80U) {
+            ++it;
+        }
+
+        return it;
+    }
+
+    // Outcome of a strict transcoder: the units read up to the first error, or all of them, and the units written.
+    struct Strict {
+        std::size_t    read;
+        std::size_t    written;
+        Expected<void> result;
+    };
+
+    // Out-of-line kernels, dispatched to the active instruction set.
+    [[nodiscard]] auto validate(std::span<const char8_t> input) noexcept -> bool;
+    // Number of units before the first ill-formed sequence, or all of them.
+    [[nodiscard]] auto valid_prefix(std::span<const char8_t> input) noexcept -> std::size_t;
+    [[nodiscard]] auto length(std::span<const char8_t> input) noexcept -> Expected<std::size_t>;
+    [[nodiscard]] auto count(std::span<const char8_t> input) noexcept -> std::size_t;
+
+    // Where stepping over codepoints from the start of some input stopped, and how many were stepped over.
+    struct Skip {
+        std::size_t offset;
+        std::size_t skipped;
+    };
+
+    // Steps over `count` codepoints, counted like `count` does, to the leading unit of the next one or the end.
+    [[nodiscard]] auto skip(std::span<const char8_t> input, std::size_t count) noexcept -> Skip;
+
+    // Number of codepoints `decode_all` produces, replacements included.
+    [[nodiscard]] auto decoded_length(std::span<const char8_t> input) noexcept -> std::size_t;
+    // Number of units `encode_all` produces, replacements included.
+    [[nodiscard]] auto encoded_length(std::span<const char32_t> input) noexcept -> std::size_t;
+    // Number of units `repair` produces.
+    [[nodiscard]] auto repaired_length(std::span<const char8_t> input) noexcept -> std::size_t;
+
+    // Transcoders writing to raw storage that must be large enough for the whole output.
+    [[nodiscard]] auto decode_all(std::span<const char8_t> input, char32_t* out) noexcept -> std::size_t;
+    // Input known to be valid is decoded without being checked.
+    [[nodiscard]] auto decode_unchecked(std::span<const char8_t> input, char32_t* out) noexcept -> std::size_t;
+    [[nodiscard]] auto decode_strict(
+        std::span<const char8_t> input,
+        char32_t*                out
+    ) noexcept -> Strict;
+
+    [[nodiscard]] auto encode_all(std::span<const char32_t> input, char8_t* out) noexcept -> std::size_t;
+    [[nodiscard]] auto encode_strict(
+        std::span<const char32_t> input,
+        char8_t*                  out
+    ) noexcept -> Strict;
+
+    [[nodiscard]] auto utf16_length(std::span<const char8_t> input) noexcept -> Expected<std::size_t>;
+
+    [[nodiscard]] auto decode_utf16(std::span<const char8_t> input, char16_t* out) noexcept -> std::size_t;
+    [[nodiscard]] auto decode_utf16_strict(
+        std::span<const char8_t> input,
+        char16_t*                out
+    ) noexcept -> Strict;
+
+    [[nodiscard]] auto encode_utf16(std::span<const char16_t> input, char8_t* out) noexcept -> std::size_t;
+    [[nodiscard]] auto encode_utf16_strict(
+        std::span<const char16_t> input,
+        char8_t*                  out
+    ) noexcept -> Strict;
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "algorithm.hpp"
+#include "error.hpp"
+#include "validation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <utility>
+
+namespace utf8 {
+    namespace detail {
+        // Holds a sequence cut off by the end of one chunk until the next chunk completes it.
+        class StreamState {
+        protected:
+            Expected<void> m_result{};
+
+            [[nodiscard]] constexpr auto has_pending() const noexcept -> bool {
+                return m_pending_length != 0U;
+            }
+
+            // Moves continuation units from the front of `chunk` into the pending sequence. Returns false if the
+            // chunk ran out before the sequence was complete, true once it is complete or cut short by another unit.
+            constexpr auto fill(std::span<const char8_t>& chunk) noexcept -> bool {
+                while(m_pending_size < m_pending_length && !chunk.empty()) {
+                    if((chunk.front() & ~CONTINUATION_UNIT_MASK) != CONTINUATION_UNIT_HEADER) {
+                        return true;
+                    }
+
+                    m_pending[m_pending_size++] = chunk.front();
+
+                    chunk = chunk.subspan(1U);
+                }
+
+                return m_pending_size == m_pending_length;
+            }
+
+            constexpr auto take_pending() noexcept -> Expected<char32_t> {
+                const auto first = m_pending.begin();
+                const auto last  = first + m_pending_size;
+
+                m_pending_size   = 0U;
+                m_pending_length = 0U;
+
+                return decode(first, last).second;
+            }
+
+            // Moves a sequence left incomplete at the end of `chunk` into the pending buffer and returns the rest.
+            constexpr auto hold_tail(const std::span<const char8_t> chunk) noexcept -> std::span<const char8_t> {
+                const std::size_t size = chunk.size();
+
+                for(std::size_t back = 1U; back <= std::min<std::size_t>(size, 3U); ++back) {
+                    const char8_t unit = chunk[size - back];
+                    if((unit & ~CONTINUATION_UNIT_MASK) == CONTINUATION_UNIT_HEADER) {
+                        continue;
+                    }
+
+                    const auto length = decoded_length(unit);
+                    if(!length || *length <= back) {
+                        break;
+                    }
+
+                    std::ranges::copy(chunk.last(back), m_pending.begin());
+
+                    m_pending_size   = static_cast<std::uint8_t>(back);
+                    m_pending_length = *length;
+
+                    return chunk.first(size - back);
+                }
+
+                return chunk;
+            }
+
+            constexpr auto finish_state() noexcept -> Expected<void> {
+                Expected<void> result = m_result;
+                if(result && has_pending()) {
+                    result = Unexpected{ take_pending().error() };
+                }
+
+                *this = StreamState{};
+
+                return result;
+            }
+
+        private:
+            std::array<char8_t, 4U> m_pending{};
+            std::uint8_t            m_pending_size{};
+            std::uint8_t            m_pending_length{};
+        };
+    }
+
+    // Validates UTF-8 arriving in chunks that may split sequences, without buffering more than one sequence.
+    // Once an error is found, every later call reports it until `finish`.
+    class StreamValidator : private detail::StreamState {
+    public:
+        constexpr auto feed(std::span<const char8_t> chunk) noexcept -> Expected<void> {
+            if(!m_result) {
+                return m_result;
+            }
+
+            if(has_pending()) {
+                if(!fill(chunk)) {
+                    return m_result;
+                }
+
+                if(const auto codepoint = take_pending(); !codepoint) {
+                    m_result = Unexpected{ codepoint.error() };
+                    return m_result;
+                }
+            }
+
+            m_result = ranges::validate(hold_tail(chunk)).result;
+
+            return m_result;
+        }
+
+        // Reports the first error, or a sequence the last chunk left incomplete, and starts a new stream.
+        [[nodiscard]] constexpr auto finish() noexcept -> Expected<void> {
+            return finish_state();
+        }
+    };
+
+    // Decodes UTF-8 arriving in chunks that may split sequences, like `decode_strict` on their concatenation.
+    // Once an error is found, every later call reports it and writes nothing until `finish`.
+    class StreamDecoder : private detail::StreamState {
+    public:
+        template<std::output_iterator<char32_t> O>
+        constexpr auto feed(std::span<const char8_t> chunk, O out) noexcept -> std::pair<O, Expected<void>> {
+            if(!m_result) {
+                return { std::move(out), m_result };
+            }
+
+            if(has_pending()) {
+                if(!fill(chunk)) {
+                    return { std::move(out), m_result };
+                }
+
+                const auto codepoint = take_pending();
+                if(!codepoint) {
+                    m_result = Unexpected{ codepoint.error() };
+                    return { std::move(out), m_result };
+                }
+
+                *out = *codepoint;
+                ++out;
+            }
+
+            auto [new_out, result] = ranges::decode_strict(hold_tail(chunk), std::move(out));
+
+            m_result = result;
+
+            return { std::move(new_out), m_result };
+        }
+
+        // Reports the first error, or a sequence the last chunk left incomplete, and starts a new stream.
+        [[nodiscard]] constexpr auto finish() noexcept -> Expected<void> {
+            return finish_state();
+        }
+    };
+}
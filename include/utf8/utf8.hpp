@@ -1,7 +1,13 @@
 #pragma once
 
 #include "algorithm.hpp"
+#include "batch.hpp"
 #include "error.hpp"
+#include "index.hpp"
 #include "iterator.hpp"
+#include "literal.hpp"
+#include "parallel.hpp"
 #include "ranges.hpp"
+#include "simd.hpp"
+#include "stream.hpp"
 #include "validation.hpp"
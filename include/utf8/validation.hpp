@@ -110,6 +110,174 @@ namespace utf8 {
 
             return codepoint <= SEQUENCE_LAST[length - 2U];
         }
+
+        // The scalar decoder is a DFA over unit classes. Like the step-by-step helpers above, it reads a whole
+        // sequence before classifying it as overlong or invalid, and only the first continuation can change that.
+        enum class UnitClass : std::uint8_t {
+            Ascii,
+            Continuation8,  // 80..8F
+            Continuation9,  // 90..9F
+            ContinuationAB, // A0..BF
+            LeadC0,         // C0..C1, always overlong
+            Lead2,          // C2..DF
+            LeadE0,
+            Lead3,          // E1..EC, EE..EF
+            LeadED,
+            LeadF0,
+            Lead4,          // F1..F3
+            LeadF4,
+            LeadF5,         // F5..F7, always above U+10FFFF
+            Illegal,        // F8..FF
+        };
+
+        // The first four states are final, the rest count the continuations still expected.
+        enum class DecodeState : std::uint8_t {
+            Accept,
+            Reject,
+            Overlong,
+            Invalid,
+            Need1,
+            Need2,
+            Need3,
+            Overlong1,
+            Overlong2,
+            Invalid1,
+            Invalid2,
+            Invalid3,
+            AfterE0,
+            AfterED,
+            AfterF0,
+            AfterF4,
+        };
+
+        inline constexpr std::size_t UNIT_CLASS_COUNT   = 14U;
+        inline constexpr std::size_t DECODE_STATE_COUNT = 16U;
+
+        inline constexpr auto UNIT_CLASSES = [] {
+            std::array<UnitClass, 256U> result{};
+
+            for(std::size_t unit = 0U; unit < result.size(); ++unit) {
+                auto& unit_class = result[unit];
+
+                if(unit < 0x80U) {
+                    unit_class = UnitClass::Ascii;
+                } else if(unit < 0x90U) {
+                    unit_class = UnitClass::Continuation8;
+                } else if(unit < 0xA0U) {
+                    unit_class = UnitClass::Continuation9;
+                } else if(unit < 0xC0U) {
+                    unit_class = UnitClass::ContinuationAB;
+                } else if(unit < 0xC2U) {
+                    unit_class = UnitClass::LeadC0;
+                } else if(unit < 0xE0U) {
+                    unit_class = UnitClass::Lead2;
+                } else if(unit == 0xE0U) {
+                    unit_class = UnitClass::LeadE0;
+                } else if(unit == 0xEDU) {
+                    unit_class = UnitClass::LeadED;
+                } else if(unit < 0xF0U) {
+                    unit_class = UnitClass::Lead3;
+                } else if(unit == 0xF0U) {
+                    unit_class = UnitClass::LeadF0;
+                } else if(unit < 0xF4U) {
+                    unit_class = UnitClass::Lead4;
+                } else if(unit == 0xF4U) {
+                    unit_class = UnitClass::LeadF4;
+                } else if(unit < 0xF8U) {
+                    unit_class = UnitClass::LeadF5;
+                } else {
+                    unit_class = UnitClass::Illegal;
+                }
+            }
+
+            return result;
+        }();
+
+        // Payload bits of a leading unit of each class.
+        inline constexpr std::array<char8_t, UNIT_CLASS_COUNT> UNIT_CLASS_MASKS = {
+            0x7FU,
+            0x00U,
+            0x00U,
+            0x00U,
+            0x1FU,
+            0x1FU,
+            0x0FU,
+            0x0FU,
+            0x0FU,
+            0x07U,
+            0x07U,
+            0x07U,
+            0x07U,
+            0x00U,
+        };
+
+        inline constexpr auto DECODE_TRANSITIONS = [] {
+            using enum DecodeState;
+            using enum UnitClass;
+
+            using Row = std::array<DecodeState, UNIT_CLASS_COUNT>;
+
+            // Continuing with each of the three continuation classes. Other units reject the sequence.
+            constexpr auto continue_with = [](
+                const DecodeState continuation_8,
+                const DecodeState continuation_9,
+                const DecodeState continuation_ab
+            ) noexcept -> Row {
+                Row row{};
+                row.fill(Reject);
+
+                row[std::to_underlying(Continuation8)]  = continuation_8;
+                row[std::to_underlying(Continuation9)]  = continuation_9;
+                row[std::to_underlying(ContinuationAB)] = continuation_ab;
+
+                return row;
+            };
+
+            // Final states start the next sequence.
+            Row start{};
+            start[std::to_underlying(Ascii)]          = Accept;
+            start[std::to_underlying(Continuation8)]  = Reject;
+            start[std::to_underlying(Continuation9)]  = Reject;
+            start[std::to_underlying(ContinuationAB)] = Reject;
+            start[std::to_underlying(LeadC0)]         = Overlong1;
+            start[std::to_underlying(Lead2)]          = Need1;
+            start[std::to_underlying(LeadE0)]         = AfterE0;
+            start[std::to_underlying(Lead3)]          = Need2;
+            start[std::to_underlying(LeadED)]         = AfterED;
+            start[std::to_underlying(LeadF0)]         = AfterF0;
+            start[std::to_underlying(Lead4)]          = Need3;
+            start[std::to_underlying(LeadF4)]         = AfterF4;
+            start[std::to_underlying(LeadF5)]         = Invalid3;
+            start[std::to_underlying(Illegal)]        = Reject;
+
+            std::array<Row, DECODE_STATE_COUNT> result{};
+            result[std::to_underlying(Accept)]    = start;
+            result[std::to_underlying(Reject)]    = start;
+            result[std::to_underlying(Overlong)]  = start;
+            result[std::to_underlying(Invalid)]   = start;
+            result[std::to_underlying(Need1)]     = continue_with(Accept, Accept, Accept);
+            result[std::to_underlying(Need2)]     = continue_with(Need1, Need1, Need1);
+            result[std::to_underlying(Need3)]     = continue_with(Need2, Need2, Need2);
+            result[std::to_underlying(Overlong1)] = continue_with(Overlong, Overlong, Overlong);
+            result[std::to_underlying(Overlong2)] = continue_with(Overlong1, Overlong1, Overlong1);
+            result[std::to_underlying(Invalid1)]  = continue_with(Invalid, Invalid, Invalid);
+            result[std::to_underlying(Invalid2)]  = continue_with(Invalid1, Invalid1, Invalid1);
+            result[std::to_underlying(Invalid3)]  = continue_with(Invalid2, Invalid2, Invalid2);
+            result[std::to_underlying(AfterE0)]   = continue_with(Overlong1, Overlong1, Need1);
+            result[std::to_underlying(AfterED)]   = continue_with(Need1, Need1, Invalid1);
+            result[std::to_underlying(AfterF0)]   = continue_with(Overlong2, Need2, Need2);
+            result[std::to_underlying(AfterF4)]   = continue_with(Need2, Invalid2, Invalid2);
+
+            return result;
+        }();
+
+        [[nodiscard]] constexpr auto next_state(const DecodeState state, const char8_t unit) noexcept -> DecodeState {
+            return DECODE_TRANSITIONS[std::to_underlying(state)][std::to_underlying(UNIT_CLASSES[unit])];
+        }
+
+        [[nodiscard]] constexpr auto is_final(const DecodeState state) noexcept -> bool {
+            return std::to_underlying(state) <= std::to_underlying(DecodeState::Invalid);
+        }
     }
 
     using Decode = char32_t;
@@ -121,48 +289,48 @@ namespace utf8 {
             return { std::move(it), std::move(out), Unexpected{ Error::InvalidByteSequence } };
         }
 
-        const auto leading_length = detail::read_leading(*it);
+        const char8_t leading = *it;
+        const auto    mask    = detail::UNIT_CLASS_MASKS[std::to_underlying(detail::UNIT_CLASSES[leading])];
 
-        *out = *it;
+        auto state     = detail::next_state(detail::DecodeState::Accept, leading);
+        auto codepoint = static_cast<char32_t>(leading & mask);
+
+        *out = leading;
         ++out;
 
         std::ranges::advance(it, 1U, end);
 
-        if(!leading_length) {
-            return { std::move(it), std::move(out), Unexpected{ leading_length.error() } };
-        }
-
-        const auto [leading, length] = *leading_length;
-
-        auto codepoint = static_cast<char32_t>(leading);
-        for(std::size_t i = 1U; i < length; ++i) {
+        while(!detail::is_final(state)) {
             if(it == end) {
                 return { std::move(it), std::move(out), Unexpected{ Error::InvalidByteSequence } };
             }
 
-            const auto continuation = detail::read_continuation(*it);
-            if(!continuation) {
-                return { std::move(it), std::move(out), Unexpected{ continuation.error() } };
+            const char8_t unit = *it;
+
+            state = detail::next_state(state, unit);
+            if(state == detail::DecodeState::Reject) {
+                return { std::move(it), std::move(out), Unexpected{ Error::InvalidByteSequence } };
             }
 
             codepoint <<= 6U;
-            codepoint |= static_cast<char32_t>(*continuation);
+            codepoint |= static_cast<char32_t>(unit & detail::CONTINUATION_UNIT_MASK);
 
-            *out = *it;
+            *out = unit;
             ++out;
 
             std::ranges::advance(it, 1U, end);
         }
 
-        if(detail::is_overlong(codepoint, length)) {
-            return { std::move(it), std::move(out), Unexpected{ Error::OverlongEncoding } };
-        }
-
-        if(is_invalid(codepoint)) {
-            return { std::move(it), std::move(out), Unexpected{ Error::InvalidCodepoint } };
+        switch(state) {
+            case detail::DecodeState::Accept:
+                return { std::move(it), std::move(out), codepoint };
+            case detail::DecodeState::Overlong:
+                return { std::move(it), std::move(out), Unexpected{ Error::OverlongEncoding } };
+            case detail::DecodeState::Invalid:
+                return { std::move(it), std::move(out), Unexpected{ Error::InvalidCodepoint } };
+            default:
+                return { std::move(it), std::move(out), Unexpected{ Error::InvalidByteSequence } };
         }
-
-        return { std::move(it), std::move(out), codepoint };
     }
 
     template<std::input_iterator I, std::sentinel_for<I> S>
@@ -194,6 +362,129 @@ namespace utf8 {
         return { std::move(new_it), std::move(codepoint) };
     }
 
+    namespace detail {
+        [[nodiscard]] constexpr auto is_continuation(const char8_t unit) noexcept -> bool {
+            return (unit & ~CONTINUATION_UNIT_MASK) == CONTINUATION_UNIT_HEADER;
+        }
+
+        // Decodes the sequence at `it` and steps over it. It must be well-formed: its length is taken from the
+        // leading unit, and nothing is checked.
+        template<std::input_iterator I>
+            requires std::same_as<std::iter_value_t<I>, char8_t>
+        [[nodiscard]] constexpr auto read_valid_sequence(I& it) noexcept -> char32_t {
+            const char8_t leading = *it;
+            ++it;
+
+            if(leading < 0x80U) {
+                return leading;
+            }
+
+            const auto length    = std::countl_one(static_cast<std::uint8_t>(leading));
+            char32_t   codepoint = leading & (0x7FU >> length);
+
+            for(int i = 1; i < length; ++i, ++it) {
+                codepoint = (codepoint << 6U) | (*it & CONTINUATION_UNIT_MASK);
+            }
+
+            return codepoint;
+        }
+    }
+
+    // Decodes the sequence that ends at `it`, where decoding forward from `begin` stops, and returns its start.
+    // Forward decoding never consumes a leading unit other than the first one of a sequence, so at most 3
+    // continuation units are stepped back over to find it. If the sequence from there does not end at `it`,
+    // the last unit is a stray continuation and is an error on its own.
+    template<std::bidirectional_iterator I>
+        requires std::same_as<std::iter_value_t<I>, char8_t>
+    [[nodiscard]] constexpr auto decode_prev(const I begin, I it) noexcept -> std::pair<I, Expected<Decode>> {
+        if(it == begin) {
+            return { std::move(it), Unexpected{ Error::InvalidByteSequence } };
+        }
+
+        const I last  = it;
+        const I stray = std::ranges::prev(it);
+
+        const char8_t unit = *stray;
+        if(unit < detail::CONTINUATION_UNIT_HEADER) {
+            return { stray, static_cast<char32_t>(unit) };
+        }
+
+        I leading = stray;
+        for(std::size_t i = 0U; i < 3U && leading != begin && detail::is_continuation(*leading); ++i) {
+            --leading;
+        }
+
+        if(detail::is_continuation(*leading)) {
+            return { stray, Unexpected{ Error::InvalidByteSequence } };
+        }
+
+        auto [next, codepoint] = decode(leading, last);
+        if(next != last) {
+            return { stray, Unexpected{ Error::InvalidByteSequence } };
+        }
+
+        return { std::move(leading), std::move(codepoint) };
+    }
+
+    namespace detail {
+        // Decodes a sequence with the step-by-step helpers, as the reference for the decoder tables.
+        [[nodiscard]] consteval auto reference_decode(
+            const std::array<char8_t, 4U>& units
+        ) noexcept -> std::pair<std::size_t, Expected<char32_t>> {
+            const auto leading = read_leading(units[0U]);
+            if(!leading) {
+                return { 1U, Unexpected{ leading.error() } };
+            }
+
+            const auto [bits, length] = *leading;
+
+            auto codepoint = static_cast<char32_t>(bits);
+            for(std::size_t i = 1U; i < length; ++i) {
+                const auto continuation = read_continuation(units[i]);
+                if(!continuation) {
+                    return { i, Unexpected{ continuation.error() } };
+                }
+
+                codepoint <<= 6U;
+                codepoint |= static_cast<char32_t>(*continuation);
+            }
+
+            if(is_overlong(codepoint, length)) {
+                return { length, Unexpected{ Error::OverlongEncoding } };
+            }
+
+            if(is_invalid(codepoint)) {
+                return { length, Unexpected{ Error::InvalidCodepoint } };
+            }
+
+            return { length, codepoint };
+        }
+
+        // Every leading unit followed by a representative of every unit class.
+        [[nodiscard]] consteval auto check_decode_tables() noexcept -> bool {
+            constexpr std::array<char8_t, 10U> SECOND_UNITS = {
+                0x00U, 0x7FU, 0x80U, 0x8FU, 0x90U, 0x9FU, 0xA0U, 0xBFU, 0xC2U, 0xFFU,
+            };
+
+            for(std::size_t leading = 0U; leading < 256U; ++leading) {
+                for(const char8_t second : SECOND_UNITS) {
+                    const std::array<char8_t, 4U> units = { static_cast<char8_t>(leading), second, 0xBFU, 0x80U };
+
+                    const auto [it, codepoint]    = decode(units.begin(), units.end());
+                    const auto [length, expected]     = reference_decode(units);
+
+                    if(static_cast<std::size_t>(it - units.begin()) != length || codepoint != expected) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    static_assert(detail::check_decode_tables(), "decoder tables disagree with the step-by-step rules");
+
     struct Encode {
         std::array<char8_t, 4U> units;
         std::uint8_t            length;
@@ -236,6 +527,62 @@ namespace utf8 {
         return result;
     }
 
+    namespace detail {
+        inline constexpr char16_t HIGH_SURROGATE_FIRST = 0xD800U;
+        inline constexpr char16_t LOW_SURROGATE_FIRST  = 0xDC00U;
+        inline constexpr char16_t LOW_SURROGATE_LAST   = 0xDFFFU;
+
+        inline constexpr char32_t SUPPLEMENTARY_FIRST = 0x10000U;
+
+        // Writes the one or two UTF-16 units of a valid codepoint.
+        template<std::output_iterator<char16_t> O>
+        constexpr auto write_utf16(const char32_t codepoint, O out) noexcept -> O {
+            if(codepoint < SUPPLEMENTARY_FIRST) {
+                *out = static_cast<char16_t>(codepoint);
+                ++out;
+
+                return out;
+            }
+
+            const char32_t offset = codepoint - SUPPLEMENTARY_FIRST;
+
+            *out = static_cast<char16_t>(HIGH_SURROGATE_FIRST + (offset >> 10U));
+            ++out;
+            *out = static_cast<char16_t>(LOW_SURROGATE_FIRST + (offset & 0x3FFU));
+            ++out;
+
+            return out;
+        }
+
+        // Reads the codepoint at the front of non-empty UTF-16 input. An unpaired surrogate is consumed on its own.
+        template<std::input_iterator I, std::sentinel_for<I> S>
+            requires std::same_as<std::iter_value_t<I>, char16_t>
+        [[nodiscard]] constexpr auto read_utf16(I it, S end) noexcept -> std::pair<I, Expected<char32_t>> {
+            const char16_t unit = *it;
+            ++it;
+
+            if(unit < HIGH_SURROGATE_FIRST || unit > LOW_SURROGATE_LAST) {
+                return { std::move(it), static_cast<char32_t>(unit) };
+            }
+
+            if(unit >= LOW_SURROGATE_FIRST || it == end) {
+                return { std::move(it), Unexpected{ Error::InvalidCodepoint } };
+            }
+
+            const char16_t low = *it;
+            if(low < LOW_SURROGATE_FIRST || low > LOW_SURROGATE_LAST) {
+                return { std::move(it), Unexpected{ Error::InvalidCodepoint } };
+            }
+
+            ++it;
+
+            const auto high_bits = static_cast<char32_t>(unit - HIGH_SURROGATE_FIRST) << 10U;
+            const auto low_bits  = static_cast<char32_t>(low - LOW_SURROGATE_FIRST);
+
+            return { std::move(it), SUPPLEMENTARY_FIRST + (high_bits | low_bits) };
+        }
+    }
+
     inline constexpr char32_t BOM         = U'\uFEFF';
     inline constexpr char32_t REPLACEMENT = U'\uFFFD';
 
@@ -0,0 +1,199 @@
+#include <utf8/batch.hpp>
+
+#include "simd/common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace utf8::batch {
+    namespace {
+        // Fields from anywhere in memory are gathered into a blob of at most this many units and fields at a time.
+        // Longer fields are validated where they are.
+        constexpr std::size_t GATHER_SIZE   = std::size_t{ 16U } << 10U;
+        constexpr std::size_t GATHER_FIELDS = 512U;
+
+        // Most fields a group can grow to.
+        constexpr std::size_t MAX_GROUP_FIELDS = 4096U;
+
+        // Calls `report(i, valid)` for each of the `count` fields of `blob`, bounded by `offset(i)` and
+        // `offset(i + 1)`, until it returns false. Returns false if it stopped.
+        // Fields are validated in groups, as one text. In a valid group, a field is valid exactly when it starts
+        // and ends on sequence boundaries, which in valid text are the units that do not continue a sequence.
+        // Otherwise each field of the group is validated on its own. Groups double after passing and halve after
+        // failing, so errors that are common cost little more than validating every field on its own.
+        template<typename Offset, typename Report>
+        auto check(const std::span<const char8_t> blob, const std::size_t count, Offset&& offset, Report&& report) noexcept -> bool {
+            std::size_t group = 1U;
+
+            for(std::size_t field = 0U; field < count;) {
+                const std::size_t last_field = std::min(count, field + group);
+
+                const std::size_t first = offset(field);
+                const std::size_t last  = offset(last_field);
+
+                const auto is_boundary = [&](const std::size_t position) noexcept {
+                    return position == last || !detail::simd::is_continuation(blob[position]);
+                };
+
+                const bool group_valid = group > 1U && detail::simd::validate(blob.subspan(first, last - first));
+
+                bool all_valid = true;
+
+                for(; field < last_field; ++field) {
+                    const std::size_t start = offset(field);
+                    const std::size_t end   = offset(field + 1U);
+
+                    const bool valid = group_valid
+                        ? start == end || (is_boundary(start) && is_boundary(end))
+                        : detail::simd::validate(blob.subspan(start, end - start));
+
+                    if(!report(field, valid)) {
+                        return false;
+                    }
+
+                    all_valid = all_valid && valid;
+                }
+
+                group = all_valid ? std::min(group * 2U, MAX_GROUP_FIELDS) : std::max<std::size_t>(group / 2U, 1U);
+            }
+
+            return true;
+        }
+
+        template<typename T, typename Report>
+        auto check(const std::span<const char8_t> blob, const std::span<const T> offsets, Report&& report) noexcept -> void {
+            if(offsets.empty()) {
+                return;
+            }
+
+            check(blob, offsets.size() - 1U, [&](const std::size_t i) noexcept {
+                return static_cast<std::size_t>(offsets[i]);
+            }, report);
+        }
+
+        template<typename Report>
+        auto check(const std::span<const std::span<const char8_t>> fields, Report&& report) noexcept -> void {
+            std::array<char8_t, GATHER_SIZE>            blob;
+            std::array<std::size_t, GATHER_FIELDS + 1U> offsets;
+
+            for(std::size_t field = 0U; field < fields.size();) {
+                if(fields[field].size() > GATHER_SIZE) {
+                    if(!report(field, detail::simd::validate(fields[field]))) {
+                        return;
+                    }
+
+                    ++field;
+                    continue;
+                }
+
+                const std::size_t base     = field;
+                std::size_t       size     = 0U;
+                std::size_t       gathered = 0U;
+
+                offsets[0U] = 0U;
+
+                for(; field < fields.size() && gathered < GATHER_FIELDS; ++field) {
+                    const auto units = fields[field];
+                    if(units.size() > GATHER_SIZE - size) {
+                        break;
+                    }
+
+                    if(!units.empty()) {
+                        std::memcpy(blob.data() + size, units.data(), units.size());
+                    }
+
+                    size += units.size();
+
+                    offsets[++gathered] = size;
+                }
+
+                const auto offset = [&](const std::size_t i) noexcept {
+                    return offsets[i];
+                };
+
+                const auto report_gathered = [&](const std::size_t i, const bool valid) noexcept {
+                    return report(base + i, valid);
+                };
+
+                if(!check(std::span<const char8_t>{ blob }.first(size), gathered, offset, report_gathered)) {
+                    return;
+                }
+            }
+        }
+
+        template<typename... Fields>
+        auto validate_into(const std::span<std::uint8_t> bitmap, const std::size_t count, const Fields&... fields) noexcept -> std::size_t {
+            std::fill_n(bitmap.begin(), (count + 7U) / 8U, std::uint8_t{ 0U });
+
+            std::size_t invalid = 0U;
+
+            check(fields..., [&](const std::size_t i, const bool valid) noexcept {
+                if(valid) {
+                    bitmap[i / 8U] |= static_cast<std::uint8_t>(1U << (i % 8U));
+                } else {
+                    ++invalid;
+                }
+
+                return true;
+            });
+
+            return invalid;
+        }
+
+        template<typename... Fields>
+        auto find_invalid(const std::size_t count, const Fields&... fields) noexcept -> std::size_t {
+            std::size_t result = count;
+
+            check(fields..., [&](const std::size_t i, const bool valid) noexcept {
+                if(!valid) {
+                    result = i;
+                }
+
+                return valid;
+            });
+
+            return result;
+        }
+
+        template<typename T>
+        [[nodiscard]] auto field_count(const std::span<const T> offsets) noexcept -> std::size_t {
+            return offsets.empty() ? 0U : offsets.size() - 1U;
+        }
+    }
+
+    auto validate(
+        const std::span<const char8_t>      blob,
+        const std::span<const std::int32_t> offsets,
+        const std::span<std::uint8_t>       bitmap
+    ) noexcept -> std::size_t {
+        return validate_into(bitmap, field_count(offsets), blob, offsets);
+    }
+
+    auto validate(
+        const std::span<const char8_t>      blob,
+        const std::span<const std::int64_t> offsets,
+        const std::span<std::uint8_t>       bitmap
+    ) noexcept -> std::size_t {
+        return validate_into(bitmap, field_count(offsets), blob, offsets);
+    }
+
+    auto validate(const std::span<const std::span<const char8_t>> fields, const std::span<std::uint8_t> bitmap) noexcept -> std::size_t {
+        return validate_into(bitmap, fields.size(), fields);
+    }
+
+    auto first_invalid(const std::span<const char8_t> blob, const std::span<const std::int32_t> offsets) noexcept -> std::size_t {
+        return find_invalid(field_count(offsets), blob, offsets);
+    }
+
+    auto first_invalid(const std::span<const char8_t> blob, const std::span<const std::int64_t> offsets) noexcept -> std::size_t {
+        return find_invalid(field_count(offsets), blob, offsets);
+    }
+
+    auto first_invalid(const std::span<const std::span<const char8_t>> fields) noexcept -> std::size_t {
+        return find_invalid(fields.size(), fields);
+    }
+}
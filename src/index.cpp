@@ -0,0 +1,120 @@
+#include <utf8/index.hpp>
+
+#include "simd/common.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <span>
+
+namespace utf8 {
+    namespace {
+        // Steps from `offset` over `count` codepoints, to the leading unit of the next one, or to the end of `units`.
+        [[nodiscard]] auto skip(
+            const std::span<const char8_t> units,
+            const std::size_t              offset,
+            const std::size_t              count
+        ) noexcept -> detail::simd::Skip {
+            const auto [next, skipped] = detail::simd::skip(units.subspan(offset), count);
+
+            return { offset + next, skipped };
+        }
+    }
+
+    OffsetIndex::OffsetIndex(const std::size_t interval, const bool track_lines)
+        : m_interval{ std::max<std::size_t>(interval, 1U) }, m_track_lines{ track_lines } {}
+
+    OffsetIndex::OffsetIndex(const std::span<const char8_t> text, const std::size_t interval, const bool track_lines)
+        : OffsetIndex{ interval, track_lines } {
+        append(text);
+    }
+
+    auto OffsetIndex::append(const std::span<const char8_t> units) -> void {
+        if(units.empty()) {
+            return;
+        }
+
+        // The next sample is the first codepoint whose number is a multiple of the interval, which may start
+        // anywhere in `units`, or not at all if they end first.
+        std::size_t offset  = 0U;
+        std::size_t pending = m_samples.size() * m_interval - m_size;
+
+        while(true) {
+            const auto [next, skipped] = skip(units, offset, pending);
+
+            m_size += skipped;
+
+            if(next == units.size()) {
+                break;
+            }
+
+            m_samples.push_back(m_size_bytes + next);
+
+            offset  = next;
+            pending = m_interval;
+        }
+
+        if(m_track_lines) {
+            const char8_t* const data = units.data();
+
+            for(std::size_t position = 0U; position != units.size();) {
+                const void* const found = std::memchr(data + position, '\n', units.size() - position);
+                if(found == nullptr) {
+                    break;
+                }
+
+                position = static_cast<std::size_t>(static_cast<const char8_t*>(found) - data) + 1U;
+
+                m_lines.push_back(m_size_bytes + position);
+            }
+        }
+
+        m_size_bytes += units.size();
+    }
+
+    auto OffsetIndex::size() const noexcept -> std::size_t {
+        return m_size;
+    }
+
+    auto OffsetIndex::size_bytes() const noexcept -> std::size_t {
+        return m_size_bytes;
+    }
+
+    auto OffsetIndex::byte_offset(const std::span<const char8_t> text, const std::size_t codepoint) const noexcept -> std::size_t {
+        const std::size_t sample = codepoint / m_interval;
+        if(sample >= m_samples.size()) {
+            return text.size();
+        }
+
+        return skip(text, m_samples[sample], codepoint % m_interval).offset;
+    }
+
+    auto OffsetIndex::codepoint_offset(const std::span<const char8_t> text, std::size_t byte) const noexcept -> std::size_t {
+        byte = std::min(byte, text.size());
+
+        const auto next = std::ranges::upper_bound(m_samples, byte);
+        if(next == m_samples.begin()) {
+            return 0U;
+        }
+
+        const auto        sample = static_cast<std::size_t>(std::ranges::distance(m_samples.begin(), next)) - 1U;
+        const std::size_t first  = m_samples[sample];
+
+        return sample * m_interval + detail::simd::count(text.subspan(first, byte - first));
+    }
+
+    auto OffsetIndex::line_count() const noexcept -> std::size_t {
+        return m_lines.size();
+    }
+
+    auto OffsetIndex::line_start(const std::size_t line) const noexcept -> std::size_t {
+        return m_lines[line];
+    }
+
+    auto OffsetIndex::line_of(const std::size_t byte) const noexcept -> std::size_t {
+        const auto next = std::ranges::upper_bound(m_lines, byte);
+
+        return static_cast<std::size_t>(std::ranges::distance(m_lines.begin(), next)) - 1U;
+    }
+}
@@ -0,0 +1,144 @@
+#include <utf8/parallel.hpp>
+
+#include "simd/common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace utf8::parallel {
+    namespace {
+        // Smallest piece of input worth its own thread.
+        constexpr std::size_t MIN_CHUNK_SIZE = std::size_t{ 64U } << 10U;
+
+        // Workers validate their chunk in slices of this size, so they can stop early once another one failed.
+        constexpr std::size_t SLICE_SIZE = std::size_t{ 256U } << 10U;
+
+        [[nodiscard]] auto chunk_count(const std::size_t size, const std::size_t thread_count) noexcept -> std::size_t {
+            const std::size_t requested = thread_count != 0U
+                ? thread_count
+                : std::max<std::size_t>(std::thread::hardware_concurrency(), 1U);
+
+            return std::clamp<std::size_t>(size / MIN_CHUNK_SIZE, 1U, requested);
+        }
+
+        // Moves `position` past at most 3 continuation units. No sequence can start before the result and end after
+        // it without being ill-formed in a way that each side detects on its own, so the two sides can be checked
+        // independently. More than 3 continuation units in a row are ill-formed wherever the split falls.
+        [[nodiscard]] auto boundary(const std::span<const char8_t> input, std::size_t position) noexcept -> std::size_t {
+            for(std::size_t i = 0U; i < 3U && position < input.size(); ++i, ++position) {
+                if(!detail::simd::is_continuation(input[position])) {
+                    break;
+                }
+            }
+
+            return position;
+        }
+
+        // Splits `input` into `count` chunks of about equal size at sequence boundaries.
+        [[nodiscard]] auto split(
+            const std::span<const char8_t> input,
+            const std::size_t              count
+        ) -> std::vector<std::span<const char8_t>> {
+            std::vector<std::span<const char8_t>> result;
+            result.reserve(count);
+
+            std::size_t first = 0U;
+            for(std::size_t i = 1U; i <= count; ++i) {
+                const std::size_t last = i == count
+                    ? input.size()
+                    : std::max(first, boundary(input, input.size() / count * i));
+
+                result.push_back(input.subspan(first, last - first));
+
+                first = last;
+            }
+
+            return result;
+        }
+
+        // Runs `work` on every chunk, the first one on the calling thread. A chunk whose thread cannot be started,
+        // when the system is out of threads or memory, runs on the calling thread instead, so this does not throw
+        // and can run inside the callback of `resize_and_overwrite`.
+        template<typename F>
+        auto for_each_chunk(const std::vector<std::span<const char8_t>>& chunks, F&& work) noexcept -> void {
+            std::vector<std::jthread> threads;
+
+            for(std::size_t i = 1U; i < chunks.size(); ++i) {
+                try {
+                    threads.emplace_back([&work, &chunks, i] {
+                        work(i, chunks[i]);
+                    });
+                } catch(...) {
+                    work(i, chunks[i]);
+                }
+            }
+
+            work(std::size_t{ 0U }, chunks.front());
+        }
+    }
+
+    auto is_valid(const std::span<const char8_t> input, const std::size_t thread_count) -> bool {
+        const std::size_t count = chunk_count(input.size(), thread_count);
+        if(count == 1U) {
+            return detail::simd::validate(input);
+        }
+
+        std::atomic<bool> failed{ false };
+
+        for_each_chunk(split(input, count), [&](std::size_t, const std::span<const char8_t> chunk) noexcept {
+            std::size_t first = 0U;
+
+            while(first != chunk.size() && !failed.load(std::memory_order_relaxed)) {
+                const std::size_t last = boundary(chunk, std::min(first + SLICE_SIZE, chunk.size()));
+
+                if(!detail::simd::validate(chunk.subspan(first, last - first))) {
+                    failed.store(true, std::memory_order_relaxed);
+                }
+
+                first = last;
+            }
+        });
+
+        return !failed.load(std::memory_order_relaxed);
+    }
+
+    auto decode_all(const std::span<const char8_t> input, const std::size_t thread_count) -> std::u32string {
+        std::u32string result;
+
+        const std::size_t count = chunk_count(input.size(), thread_count);
+        if(count == 1U) {
+            result.resize_and_overwrite(input.size(), [&](char32_t* const data, std::size_t) noexcept {
+                return detail::simd::decode_all(input, data);
+            });
+
+            return result;
+        }
+
+        const auto chunks = split(input, count);
+
+        // Chunk i writes from offsets[i], the exclusive prefix sum of the lengths before it.
+        std::vector<std::size_t> offsets(count + 1U);
+
+        for_each_chunk(chunks, [&](const std::size_t i, const std::span<const char8_t> chunk) noexcept {
+            offsets[i + 1U] = detail::simd::decoded_length(chunk);
+        });
+
+        std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+        result.resize_and_overwrite(offsets.back(), [&](char32_t* const data, std::size_t) noexcept {
+            for_each_chunk(chunks, [&](const std::size_t i, const std::span<const char8_t> chunk) noexcept {
+                (void)detail::simd::decode_all(chunk, data + offsets[i]);
+            });
+
+            return offsets.back();
+        });
+
+        return result;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "common.hpp"
+
+#if UTF8_X86
+
+UTF8_TARGET_PUSH(UTF8_TARGET_AVX2)
+
+namespace utf8::detail::simd {
+    struct Avx2 {
+        using Register = __m256i;
+
+        static constexpr std::size_t SIZE = 32U;
+
+        [[nodiscard]] static auto zero() noexcept -> Register {
+            return _mm256_setzero_si256();
+        }
+
+        [[nodiscard]] static auto splat(const std::uint8_t value) noexcept -> Register {
+            return _mm256_set1_epi8(static_cast<char>(value));
+        }
+
+        [[nodiscard]] static auto load(const void* const data) noexcept -> Register {
+            return _mm256_loadu_si256(static_cast<const Register*>(data));
+        }
+
+        [[nodiscard]] static auto load_last(const std::uint8_t* const block) noexcept -> Register {
+            return load(block + BLOCK_SIZE - SIZE);
+        }
+
+        [[nodiscard]] static auto table(const std::uint8_t* const table) noexcept -> Register {
+            return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+        }
+
+        [[nodiscard]] static auto bit_or(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm256_or_si256(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_and(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm256_and_si256(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_xor(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm256_xor_si256(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto saturating_sub(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm256_subs_epu8(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto shift_right_4(const Register value) noexcept -> Register {
+            return _mm256_and_si256(_mm256_srli_epi16(value, 4), splat(0x0FU));
+        }
+
+        [[nodiscard]] static auto lookup(const Register table, const Register index) noexcept -> Register {
+            return _mm256_shuffle_epi8(table, index);
+        }
+
+        template<int N>
+        [[nodiscard]] static auto prev(const Register input, const Register prev_input) noexcept -> Register {
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+        }
+
+        // Bit per unit that is not a continuation unit, i.e. signed greater than 0xBF.
+        [[nodiscard]] static auto leading_bits(const Register value) noexcept -> std::uint64_t {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(value, splat(0xBFU))));
+        }
+
+        // Zero-extends every unit of an all-ASCII register into a codepoint or UTF-16 unit.
+        static auto widen(const Register value, char32_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m256i*>(out);
+
+            const __m128i low  = _mm256_castsi256_si128(value);
+            const __m128i high = _mm256_extracti128_si256(value, 1);
+
+            _mm256_storeu_si256(dest + 0, _mm256_cvtepu8_epi32(low));
+            _mm256_storeu_si256(dest + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+            _mm256_storeu_si256(dest + 2, _mm256_cvtepu8_epi32(high));
+            _mm256_storeu_si256(dest + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+        }
+
+        static auto widen(const Register value, char16_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m256i*>(out);
+
+            _mm256_storeu_si256(dest + 0, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(value)));
+            _mm256_storeu_si256(dest + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(value, 1)));
+        }
+
+        // Bit per unit with its high bit set.
+        [[nodiscard]] static auto high_bits(const Register value) noexcept -> std::uint64_t {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(value));
+        }
+
+        [[nodiscard]] static auto any_high_bit(const Register value) noexcept -> bool {
+            return _mm256_movemask_epi8(value) != 0;
+        }
+
+        [[nodiscard]] static auto any_bit(const Register value) noexcept -> bool {
+            return _mm256_testz_si256(value, value) == 0;
+        }
+    };
+}
+
+UTF8_TARGET_POP()
+
+#endif
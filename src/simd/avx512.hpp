@@ -0,0 +1,109 @@
+#pragma once
+
+#include "common.hpp"
+
+#if UTF8_X86
+
+UTF8_TARGET_PUSH(UTF8_TARGET_AVX512)
+
+namespace utf8::detail::simd {
+    struct Avx512 {
+        using Register = __m512i;
+
+        static constexpr std::size_t SIZE = 64U;
+
+        [[nodiscard]] static auto zero() noexcept -> Register {
+            return _mm512_setzero_si512();
+        }
+
+        [[nodiscard]] static auto splat(const std::uint8_t value) noexcept -> Register {
+            return _mm512_set1_epi8(static_cast<char>(value));
+        }
+
+        [[nodiscard]] static auto load(const void* const data) noexcept -> Register {
+            return _mm512_loadu_si512(data);
+        }
+
+        [[nodiscard]] static auto load_last(const std::uint8_t* const block) noexcept -> Register {
+            return load(block + BLOCK_SIZE - SIZE);
+        }
+
+        [[nodiscard]] static auto table(const std::uint8_t* const table) noexcept -> Register {
+            return _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+        }
+
+        [[nodiscard]] static auto bit_or(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm512_or_si512(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_and(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm512_and_si512(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_xor(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm512_xor_si512(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto saturating_sub(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm512_subs_epu8(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto shift_right_4(const Register value) noexcept -> Register {
+            return _mm512_and_si512(_mm512_srli_epi16(value, 4), splat(0x0FU));
+        }
+
+        [[nodiscard]] static auto lookup(const Register table, const Register index) noexcept -> Register {
+            return _mm512_shuffle_epi8(table, index);
+        }
+
+        template<int N>
+        [[nodiscard]] static auto prev(const Register input, const Register prev_input) noexcept -> Register {
+            const Register shifted = _mm512_permutex2var_epi64(
+                prev_input,
+                _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6),
+                input
+            );
+
+            return _mm512_alignr_epi8(input, shifted, 16 - N);
+        }
+
+        // Bit per unit that is not a continuation unit, i.e. signed greater than 0xBF.
+        [[nodiscard]] static auto leading_bits(const Register value) noexcept -> std::uint64_t {
+            return _mm512_cmpgt_epi8_mask(value, splat(0xBFU));
+        }
+
+        // Zero-extends every unit of an all-ASCII register into a codepoint or UTF-16 unit.
+        static auto widen(const Register value, char32_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m512i*>(out);
+
+            _mm512_storeu_si512(dest + 0, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(value, 0)));
+            _mm512_storeu_si512(dest + 1, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(value, 1)));
+            _mm512_storeu_si512(dest + 2, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(value, 2)));
+            _mm512_storeu_si512(dest + 3, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(value, 3)));
+        }
+
+        static auto widen(const Register value, char16_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m512i*>(out);
+
+            _mm512_storeu_si512(dest + 0, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(value, 0)));
+            _mm512_storeu_si512(dest + 1, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(value, 1)));
+        }
+
+        // Bit per unit with its high bit set.
+        [[nodiscard]] static auto high_bits(const Register value) noexcept -> std::uint64_t {
+            return _mm512_movepi8_mask(value);
+        }
+
+        [[nodiscard]] static auto any_high_bit(const Register value) noexcept -> bool {
+            return _mm512_movepi8_mask(value) != 0U;
+        }
+
+        [[nodiscard]] static auto any_bit(const Register value) noexcept -> bool {
+            return _mm512_test_epi8_mask(value, value) != 0U;
+        }
+    };
+}
+
+UTF8_TARGET_POP()
+
+#endif
@@ -0,0 +1,407 @@
+#pragma once
+
+#include <utf8/error.hpp>
+#include <utf8/simd.hpp>
+#include <utf8/validation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    #define UTF8_X86 1
+
+    #include <immintrin.h>
+#else
+    #define UTF8_X86 0
+#endif
+
+#define UTF8_STRINGIFY(x) #x
+
+#if defined(__clang__)
+    #define UTF8_TARGET_PUSH(features) \
+        _Pragma(UTF8_STRINGIFY(clang attribute push(__attribute__((target(features))), apply_to = function)))
+    #define UTF8_TARGET_POP() _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+    #define UTF8_TARGET_PUSH(features) _Pragma("GCC push_options") _Pragma(UTF8_STRINGIFY(GCC target(features)))
+    #define UTF8_TARGET_POP()          _Pragma("GCC pop_options")
+#else
+    #define UTF8_TARGET_PUSH(features)
+    #define UTF8_TARGET_POP()
+#endif
+
+#define UTF8_TARGET_SSE42  "sse4.2,popcnt"
+#define UTF8_TARGET_AVX2   "avx2,bmi,bmi2,lzcnt,popcnt"
+#define UTF8_TARGET_AVX512 "avx512f,avx512bw,avx512vl,avx2,bmi,bmi2,lzcnt,popcnt"
+
+namespace utf8::detail::simd {
+    struct Transcode {
+        std::size_t read;
+        std::size_t written;
+    };
+
+    struct Kernels {
+        Isa isa;
+
+        auto (*validate)(const char8_t* data, std::size_t size) noexcept -> bool;
+        auto (*valid_prefix)(const char8_t* data, std::size_t size) noexcept -> std::size_t;
+        auto (*length)(const char8_t* data, std::size_t size) noexcept -> Expected<std::size_t>;
+        auto (*count)(const char8_t* data, std::size_t size) noexcept -> std::size_t;
+
+        // Transcodes the longest valid prefix; `read` stops at the first ill-formed sequence.
+        auto (*decode_valid)(const char8_t* data, std::size_t size, char32_t* out) noexcept -> Transcode;
+        // Encodes the longest prefix of valid codepoints; `read` stops at the first invalid one.
+        auto (*encode_valid)(const char32_t* data, std::size_t size, char8_t* out) noexcept -> Transcode;
+
+        // Decodes input known to be valid without checking it. Returns the number of codepoints written.
+        auto (*decode_unchecked)(const char8_t* data, std::size_t size, char32_t* out) noexcept -> std::size_t;
+
+        // Number of UTF-16 units valid input transcodes to.
+        auto (*utf16_length)(const char8_t* data, std::size_t size) noexcept -> Expected<std::size_t>;
+        // As `decode_valid` and `encode_valid`, but to and from UTF-16; unpaired surrogates are invalid.
+        auto (*decode_valid_utf16)(const char8_t* data, std::size_t size, char16_t* out) noexcept -> Transcode;
+        auto (*encode_valid_utf16)(const char16_t* data, std::size_t size, char8_t* out) noexcept -> Transcode;
+    };
+
+    [[nodiscard]] constexpr auto is_continuation(const char8_t unit) noexcept -> bool {
+        return (unit & 0xC0U) == 0x80U;
+    }
+
+    // Length of the well-formed sequence starting at `it`, or 0 if it is ill-formed or cut off by `end`.
+    // Mirrors the rules of `decode_into`: no overlong forms, no surrogates, nothing above U+10FFFF.
+    [[nodiscard]] constexpr auto sequence_length(const char8_t* it, const char8_t* end) noexcept -> std::size_t {
+        const char8_t leading = *it;
+        if(leading < 0x80U) {
+            return 1U;
+        }
+
+        std::size_t length = 0U;
+        char8_t     low    = 0x80U;
+        char8_t     high   = 0xBFU;
+
+        if(leading < 0xC2U) {
+            return 0U;
+        } else if(leading < 0xE0U) {
+            length = 2U;
+        } else if(leading < 0xF0U) {
+            length = 3U;
+
+            if(leading == 0xE0U) {
+                low = 0xA0U;
+            } else if(leading == 0xEDU) {
+                high = 0x9FU;
+            }
+        } else if(leading < 0xF5U) {
+            length = 4U;
+
+            if(leading == 0xF0U) {
+                low = 0x90U;
+            } else if(leading == 0xF4U) {
+                high = 0x8FU;
+            }
+        } else {
+            return 0U;
+        }
+
+        if(static_cast<std::size_t>(end - it) < length) {
+            return 0U;
+        }
+
+        if(it[1U] < low || it[1U] > high) {
+            return 0U;
+        }
+
+        for(std::size_t i = 2U; i < length; ++i) {
+            if((it[i] & 0xC0U) != 0x80U) {
+                return 0U;
+            }
+        }
+
+        return length;
+    }
+
+    inline constexpr std::size_t BLOCK_SIZE = 64U;
+
+    // Writes the units of a valid codepoint and returns how many there are.
+    [[nodiscard]] constexpr auto encode_valid(char32_t codepoint, char8_t* const out) noexcept -> std::size_t {
+        if(codepoint < 0x80U) {
+            out[0U] = static_cast<char8_t>(codepoint);
+            return 1U;
+        }
+
+        if(codepoint < 0x800U) {
+            out[0U] = static_cast<char8_t>(0xC0U | codepoint >> 6U);
+            out[1U] = static_cast<char8_t>(0x80U | codepoint & 0x3FU);
+            return 2U;
+        }
+
+        if(codepoint < 0x10000U) {
+            out[0U] = static_cast<char8_t>(0xE0U | codepoint >> 12U);
+            out[1U] = static_cast<char8_t>(0x80U | codepoint >> 6U & 0x3FU);
+            out[2U] = static_cast<char8_t>(0x80U | codepoint & 0x3FU);
+            return 3U;
+        }
+
+        out[0U] = static_cast<char8_t>(0xF0U | codepoint >> 18U);
+        out[1U] = static_cast<char8_t>(0x80U | codepoint >> 12U & 0x3FU);
+        out[2U] = static_cast<char8_t>(0x80U | codepoint >> 6U & 0x3FU);
+        out[3U] = static_cast<char8_t>(0x80U | codepoint & 0x3FU);
+        return 4U;
+    }
+
+    // Where the scalar code resumes once the block checker failed on the block at `it`. The checker flags an
+    // ill-formed sequence up to 3 units after its first one, so the sequence may start in the 3 units before `it`;
+    // everything before those is valid, and the result is the start of the sequence covering the earliest of them.
+    [[nodiscard]] inline auto resume_point(const char8_t* const data, const char8_t* const it) noexcept -> const char8_t* {
+        const char8_t* first = it - std::min<std::ptrdiff_t>(it - data, 3);
+        for(std::size_t i = 0U; i < 3U && first != data && is_continuation(*first); ++i) {
+            --first;
+        }
+
+        return first;
+    }
+
+    // Finishes `length` with the scalar decoder once the block checker failed on the block at `it`,
+    // with `count` codepoints starting before `it`.
+    [[nodiscard]] inline auto resume_length(
+        const char8_t* const data,
+        const char8_t* const it,
+        const char8_t* const end,
+        std::size_t          count
+    ) noexcept -> Expected<std::size_t> {
+        const char8_t* first = resume_point(data, it);
+        for(const char8_t* unit = first; unit != it; ++unit) {
+            count -= is_continuation(*unit) ? 0U : 1U;
+        }
+
+        while(first != end) {
+            const auto [next, codepoint] = decode(first, end);
+            if(!codepoint) {
+                return Unexpected{ codepoint.error() };
+            }
+
+            first = next;
+
+            ++count;
+        }
+
+        return count;
+    }
+
+    // Offset of the first ill-formed sequence once the block checker failed on the block at `it`.
+    // Only the failing block and the few units before it are scanned.
+    [[nodiscard]] inline auto locate_error(
+        const char8_t* const data,
+        const char8_t* const it,
+        const char8_t* const end
+    ) noexcept -> std::size_t {
+        const char8_t* first = resume_point(data, it);
+
+        while(first != end) {
+            const auto length = sequence_length(first, end);
+            if(length == 0U) {
+                break;
+            }
+
+            first += length;
+        }
+
+        return static_cast<std::size_t>(first - data);
+    }
+
+    // Lookup-table classifier of Keiser and Lemire: every byte pair is classified by three nibble lookups
+    // whose intersection is non-zero exactly when the pair cannot appear in well-formed UTF-8.
+    namespace lookup {
+        inline constexpr std::uint8_t TOO_SHORT      = 1U << 0U;
+        inline constexpr std::uint8_t TOO_LONG       = 1U << 1U;
+        inline constexpr std::uint8_t OVERLONG_3     = 1U << 2U;
+        inline constexpr std::uint8_t TOO_LARGE      = 1U << 3U;
+        inline constexpr std::uint8_t SURROGATE      = 1U << 4U;
+        inline constexpr std::uint8_t OVERLONG_2     = 1U << 5U;
+        inline constexpr std::uint8_t TOO_LARGE_1000 = 1U << 6U;
+        inline constexpr std::uint8_t OVERLONG_4     = 1U << 6U;
+        inline constexpr std::uint8_t TWO_CONTS      = 1U << 7U;
+        inline constexpr std::uint8_t CARRY          = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        alignas(16) inline constexpr std::array<std::uint8_t, 16U> BYTE_1_HIGH = {
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+            TOO_SHORT | OVERLONG_2,
+            TOO_SHORT,
+            TOO_SHORT | OVERLONG_3 | SURROGATE,
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+        };
+
+        alignas(16) inline constexpr std::array<std::uint8_t, 16U> BYTE_1_LOW = {
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+            CARRY | OVERLONG_2,
+            CARRY,
+            CARRY,
+            CARRY | TOO_LARGE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+            CARRY | TOO_LARGE | TOO_LARGE_1000,
+        };
+
+        alignas(16) inline constexpr std::array<std::uint8_t, 16U> BYTE_2_HIGH = {
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        };
+
+        // Upper bound of each of the last three units of a block that does not leave a sequence open.
+        alignas(64) inline constexpr std::array<std::uint8_t, BLOCK_SIZE> INCOMPLETE_MAX = [] {
+            std::array<std::uint8_t, BLOCK_SIZE> result{};
+            result.fill(0xFFU);
+
+            result[BLOCK_SIZE - 3U] = 0xF0U - 1U;
+            result[BLOCK_SIZE - 2U] = 0xE0U - 1U;
+            result[BLOCK_SIZE - 1U] = 0xC0U - 1U;
+
+            return result;
+        }();
+    }
+
+    // Shuffle patterns that move the sequences at the front of 16 units into 32-bit lanes, last unit lowest.
+    // A pattern is picked by the 12-bit mask of units that end a sequence; it covers at most 4 sequences.
+    namespace decode_lookup {
+        struct Pattern {
+            alignas(16) std::array<std::uint8_t, 16U> shuffle;
+            std::uint8_t                              consumed;
+            std::uint8_t                              count;
+        };
+
+        inline constexpr std::size_t MASK_BITS = 12U;
+
+        // Sequence lengths l0..l3 in 1..4, or 0 past the last one, packed as l0 + 5 * l1 + 25 * l2 + 125 * l3.
+        inline constexpr std::size_t KEY_COUNT = 5U * 5U * 5U * 5U;
+
+        [[nodiscard]] constexpr auto key_of(const std::uint16_t ends) noexcept -> std::uint16_t {
+            std::uint16_t key   = 0U;
+            std::uint16_t scale = 1U;
+            std::size_t   start = 0U;
+
+            for(std::size_t i = 0U; i < 4U; ++i) {
+                std::size_t end = start;
+                while(end < MASK_BITS && (ends >> end & 1U) == 0U) {
+                    ++end;
+                }
+
+                if(end == MASK_BITS || end - start >= 4U) {
+                    break;
+                }
+
+                key   += static_cast<std::uint16_t>((end - start + 1U) * scale);
+                scale *= 5U;
+                start  = end + 1U;
+            }
+
+            return key;
+        }
+
+        inline constexpr auto KEYS = [] {
+            std::array<std::uint16_t, std::size_t{ 1U } << MASK_BITS> result{};
+            for(std::size_t ends = 0U; ends < result.size(); ++ends) {
+                result[ends] = key_of(static_cast<std::uint16_t>(ends));
+            }
+
+            return result;
+        }();
+
+        inline constexpr auto PATTERNS = [] {
+            std::array<Pattern, KEY_COUNT> result{};
+
+            for(std::size_t key = 0U; key < KEY_COUNT; ++key) {
+                auto& pattern = result[key];
+                pattern.shuffle.fill(0x80U);
+
+                std::size_t lengths = key;
+                std::size_t start   = 0U;
+
+                for(std::size_t lane = 0U; lane < 4U && lengths % 5U != 0U; ++lane, lengths /= 5U) {
+                    const std::size_t length = lengths % 5U;
+                    const std::size_t last   = start + length - 1U;
+
+                    for(std::size_t i = 0U; i < length; ++i) {
+                        pattern.shuffle[lane * 4U + i] = static_cast<std::uint8_t>(last - i);
+                    }
+
+                    start += length;
+
+                    ++pattern.count;
+                }
+
+                pattern.consumed = static_cast<std::uint8_t>(start);
+            }
+
+            return result;
+        }();
+
+        static_assert(PATTERNS[KEYS[0b0000'0000'1111U]].count == 4U);
+        static_assert(PATTERNS[KEYS[0b0000'0000'1111U]].consumed == 4U);
+        static_assert(PATTERNS[KEYS[0b1000'1000'1000U]].count == 3U);
+        static_assert(PATTERNS[KEYS[0b1000'1000'1000U]].consumed == 12U);
+        static_assert(PATTERNS[KEYS[0b0000'0000'1010U]].shuffle[4U] == 3U);
+
+        // Payload bits of a unit, selected by its high nibble.
+        alignas(16) inline constexpr std::array<std::uint8_t, 16U> PAYLOAD_MASKS = {
+            0x7FU, 0x7FU, 0x7FU, 0x7FU, 0x7FU, 0x7FU, 0x7FU, 0x7FU,
+            0x3FU, 0x3FU, 0x3FU, 0x3FU,
+            0x1FU, 0x1FU,
+            0x0FU,
+            0x07U,
+        };
+    }
+
+    // Shuffle patterns that gather the units of 4 encoded codepoints, stored last unit lowest in 32-bit lanes,
+    // into consecutive bytes. A pattern is picked by the lane lengths minus one, 2 bits per lane.
+    namespace encode_lookup {
+        struct Pattern {
+            alignas(16) std::array<std::uint8_t, 16U> shuffle;
+            std::uint8_t                              length;
+        };
+
+        inline constexpr auto PATTERNS = [] {
+            std::array<Pattern, 256U> result{};
+
+            for(std::size_t index = 0U; index < result.size(); ++index) {
+                auto& pattern = result[index];
+                pattern.shuffle.fill(0x80U);
+
+                std::size_t position = 0U;
+                for(std::size_t lane = 0U; lane < 4U; ++lane) {
+                    const std::size_t length = (index >> lane * 2U & 0x03U) + 1U;
+
+                    for(std::size_t i = length; i > 0U; --i) {
+                        pattern.shuffle[position++] = static_cast<std::uint8_t>(lane * 4U + i - 1U);
+                    }
+                }
+
+                pattern.length = static_cast<std::uint8_t>(position);
+            }
+
+            return result;
+        }();
+
+        static_assert(PATTERNS[0x00U].length == 4U);
+        static_assert(PATTERNS[0xFFU].length == 16U);
+        static_assert(PATTERNS[0x01U].shuffle[0U] == 1U && PATTERNS[0x01U].shuffle[1U] == 0U);
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "common.hpp"
+
+namespace utf8::detail::simd::fallback {
+    [[nodiscard]] inline auto validate(const char8_t* const data, const std::size_t size) noexcept -> bool {
+        const char8_t*       it  = data;
+        const char8_t* const end = data + size;
+
+        while(true) {
+            it = skip_ascii(it, end);
+            if(it == end) {
+                return true;
+            }
+
+            const auto length = sequence_length(it, end);
+            if(length == 0U) {
+                return false;
+            }
+
+            it += length;
+        }
+    }
+
+    [[nodiscard]] inline auto valid_prefix(const char8_t* const data, const std::size_t size) noexcept -> std::size_t {
+        const char8_t*       it  = data;
+        const char8_t* const end = data + size;
+
+        while(true) {
+            it = skip_ascii(it, end);
+            if(it == end) {
+                return size;
+            }
+
+            const auto length = sequence_length(it, end);
+            if(length == 0U) {
+                return static_cast<std::size_t>(it - data);
+            }
+
+            it += length;
+        }
+    }
+
+    [[nodiscard]] inline auto length(const char8_t* const data, const std::size_t size) noexcept -> Expected<std::size_t> {
+        const char8_t*       it  = data;
+        const char8_t* const end = data + size;
+
+        std::size_t result = 0U;
+
+        while(true) {
+            const char8_t* const next = skip_ascii(it, end);
+
+            result += static_cast<std::size_t>(next - it);
+            it      = next;
+
+            if(it == end) {
+                return result;
+            }
+
+            const auto length = sequence_length(it, end);
+            if(length == 0U) {
+                return Unexpected{ decode(it, end).second.error() };
+            }
+
+            it += length;
+
+            ++result;
+        }
+    }
+
+    [[nodiscard]] inline auto count(const char8_t* const data, const std::size_t size) noexcept -> std::size_t {
+        constexpr std::uint64_t HIGH_BITS = 0x8080808080808080U;
+
+        const char8_t*       it  = data;
+        const char8_t* const end = data + size;
+
+        std::size_t continuations = 0U;
+
+        for(; end - it >= 8; it += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, it, sizeof(word));
+
+            // A continuation unit has its high bit set and the bit below it clear.
+            continuations += static_cast<std::size_t>(std::popcount(word & ~(word << 1U) & HIGH_BITS));
+        }
+
+        for(; it != end; ++it) {
+            continuations += is_continuation(*it) ? 1U : 0U;
+        }
+
+        return size - continuations;
+    }
+
+    [[nodiscard]] inline auto utf16_length(
+        const char8_t* const data,
+        const std::size_t    size
+    ) noexcept -> Expected<std::size_t> {
+        const char8_t*       it  = data;
+        const char8_t* const end = data + size;
+
+        std::size_t result = 0U;
+
+        while(true) {
+            const char8_t* const next = skip_ascii(it, end);
+
+            result += static_cast<std::size_t>(next - it);
+            it      = next;
+
+            if(it == end) {
+                return result;
+            }
+
+            const auto length = sequence_length(it, end);
+            if(length == 0U) {
+                return Unexpected{ decode(it, end).second.error() };
+            }
+
+            it += length;
+
+            result += length == 4U ? 2U : 1U;
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] auto decode_valid(const char8_t* const data, const std::size_t size, T* const out) noexcept -> Transcode {
+        const char8_t*       it   = data;
+        const char8_t* const end  = data + size;
+        T*                   dest = out;
+
+        while(true) {
+            for(const char8_t* const next = skip_ascii(it, end); it != next; ++it, ++dest) {
+                *dest = *it;
+            }
+
+            if(it == end) {
+                break;
+            }
+
+            const auto [next, codepoint] = decode(it, end);
+            if(!codepoint) {
+                break;
+            }
+
+            if constexpr(std::same_as<T, char32_t>) {
+                *dest = *codepoint;
+                ++dest;
+            } else {
+                dest = write_utf16(*codepoint, dest);
+            }
+
+            it = next;
+        }
+
+        return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+    }
+
+    [[nodiscard]] inline auto decode_unchecked(const char8_t* const data, const std::size_t size, char32_t* const out) noexcept -> std::size_t {
+        const char8_t*       it   = data;
+        const char8_t* const end  = data + size;
+        char32_t*            dest = out;
+
+        while(true) {
+            for(const char8_t* const next = skip_ascii(it, end); it != next; ++it, ++dest) {
+                *dest = *it;
+            }
+
+            if(it == end) {
+                break;
+            }
+
+            *dest = read_valid_sequence(it);
+            ++dest;
+        }
+
+        return static_cast<std::size_t>(dest - out);
+    }
+
+    [[nodiscard]] inline auto encode_valid(
+        const char32_t* const data,
+        const std::size_t     size,
+        char8_t* const        out
+    ) noexcept -> Transcode {
+        const char32_t*       it   = data;
+        const char32_t* const end  = data + size;
+        char8_t*              dest = out;
+
+        for(; it != end; ++it) {
+            if(is_invalid(*it)) {
+                break;
+            }
+
+            dest += simd::encode_valid(*it, dest);
+        }
+
+        return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+    }
+
+    [[nodiscard]] inline auto encode_valid_utf16(
+        const char16_t* const data,
+        const std::size_t     size,
+        char8_t* const        out
+    ) noexcept -> Transcode {
+        const char16_t*       it   = data;
+        const char16_t* const end  = data + size;
+        char8_t*              dest = out;
+
+        while(it != end) {
+            const auto [next, codepoint] = read_utf16(it, end);
+            if(!codepoint) {
+                break;
+            }
+
+            dest += simd::encode_valid(*codepoint, dest);
+
+            it = next;
+        }
+
+        return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+    }
+
+    inline constexpr Kernels KERNELS = {
+        .isa          = Isa::Fallback,
+        .validate     = &validate,
+        .valid_prefix = &valid_prefix,
+        .length       = &length,
+        .count        = &count,
+        .decode_valid = &decode_valid<char32_t>,
+        .encode_valid = &encode_valid,
+
+        .decode_unchecked = &decode_unchecked,
+
+        .utf16_length       = &utf16_length,
+        .decode_valid_utf16 = &decode_valid<char16_t>,
+        .encode_valid_utf16 = &encode_valid_utf16,
+    };
+}
@@ -0,0 +1,623 @@
+// Instruction set independent kernels, written against the register wrapper `Simd`.
+//
+// This file is included once per instruction set, inside that instruction set's target region and namespace,
+// which must declare `Simd` and `ISA` beforehand. It must not include anything itself.
+
+inline constexpr std::size_t COUNT = BLOCK_SIZE / Simd::SIZE;
+
+// Number of units in the block that do not continue a sequence, i.e. the number of codepoints starting in it.
+[[nodiscard]] inline auto count_leading(const char8_t* const block) noexcept -> std::size_t {
+    std::size_t result = 0U;
+    for(std::size_t i = 0U; i < COUNT; ++i) {
+        result += static_cast<std::size_t>(std::popcount(Simd::leading_bits(Simd::load(block + i * Simd::SIZE))));
+    }
+
+    return result;
+}
+
+// Number of units in the block that lead a four unit sequence, whose codepoint takes two UTF-16 units.
+[[nodiscard]] inline auto count_supplementary(const char8_t* const block) noexcept -> std::size_t {
+    std::size_t result = 0U;
+    for(std::size_t i = 0U; i < COUNT; ++i) {
+        const auto input = Simd::load(block + i * Simd::SIZE);
+
+        result += static_cast<std::size_t>(std::popcount(Simd::high_bits(Simd::saturating_sub(input, Simd::splat(0x70U)))));
+    }
+
+    return result;
+}
+
+class Checker {
+    using Register = Simd::Register;
+
+public:
+    auto check(const char8_t* const block) noexcept -> void {
+        Register input[COUNT];
+        Register any = Simd::zero();
+
+        for(std::size_t i = 0U; i < COUNT; ++i) {
+            input[i] = Simd::load(block + i * Simd::SIZE);
+            any      = Simd::bit_or(any, input[i]);
+        }
+
+        if(!Simd::any_high_bit(any)) {
+            m_error           = Simd::bit_or(m_error, m_prev_incomplete);
+            m_prev_input      = input[COUNT - 1U];
+            m_prev_incomplete = Simd::zero();
+            return;
+        }
+
+        for(std::size_t i = 0U; i < COUNT; ++i) {
+            m_error      = Simd::bit_or(m_error, classify(input[i], m_prev_input));
+            m_prev_input = input[i];
+        }
+
+        m_prev_incomplete = Simd::saturating_sub(m_prev_input, Simd::load_last(lookup::INCOMPLETE_MAX.data()));
+    }
+
+    [[nodiscard]] auto has_error() const noexcept -> bool {
+        return Simd::any_bit(m_error);
+    }
+
+private:
+    Register m_error           = Simd::zero();
+    Register m_prev_input      = Simd::zero();
+    Register m_prev_incomplete = Simd::zero();
+
+    [[nodiscard]] static auto classify(const Register input, const Register prev_input) noexcept -> Register {
+        const Register prev1 = Simd::prev<1>(input, prev_input);
+
+        const Register byte_1_high = Simd::lookup(
+            Simd::table(lookup::BYTE_1_HIGH.data()),
+            Simd::shift_right_4(prev1)
+        );
+        const Register byte_1_low = Simd::lookup(
+            Simd::table(lookup::BYTE_1_LOW.data()),
+            Simd::bit_and(prev1, Simd::splat(0x0FU))
+        );
+        const Register byte_2_high = Simd::lookup(
+            Simd::table(lookup::BYTE_2_HIGH.data()),
+            Simd::shift_right_4(input)
+        );
+
+        const Register special = Simd::bit_and(Simd::bit_and(byte_1_high, byte_1_low), byte_2_high);
+
+        const Register prev2 = Simd::prev<2>(input, prev_input);
+        const Register prev3 = Simd::prev<3>(input, prev_input);
+
+        const Register is_third  = Simd::saturating_sub(prev2, Simd::splat(0xE0U - 0x80U));
+        const Register is_fourth = Simd::saturating_sub(prev3, Simd::splat(0xF0U - 0x80U));
+        const Register must_be_continuation = Simd::bit_and(Simd::bit_or(is_third, is_fourth), Simd::splat(0x80U));
+
+        return Simd::bit_xor(must_be_continuation, special);
+    }
+};
+
+[[nodiscard]] inline auto validate(const char8_t* const data, const std::size_t size) noexcept -> bool {
+    const char8_t*       it  = data;
+    const char8_t* const end = data + size;
+
+    Checker checker{};
+
+    for(; static_cast<std::size_t>(end - it) >= BLOCK_SIZE; it += BLOCK_SIZE) {
+        checker.check(it);
+
+        if(checker.has_error()) {
+            return false;
+        }
+    }
+
+    // The zero padding terminates any sequence left open by the last full block.
+    std::array<char8_t, BLOCK_SIZE> tail{};
+    if(it != end) {
+        std::memcpy(tail.data(), it, static_cast<std::size_t>(end - it));
+    }
+
+    checker.check(tail.data());
+
+    return !checker.has_error();
+}
+
+[[nodiscard]] inline auto valid_prefix(const char8_t* const data, const std::size_t size) noexcept -> std::size_t {
+    const char8_t*       it  = data;
+    const char8_t* const end = data + size;
+
+    Checker checker{};
+
+    for(; static_cast<std::size_t>(end - it) >= BLOCK_SIZE; it += BLOCK_SIZE) {
+        checker.check(it);
+
+        if(checker.has_error()) {
+            return locate_error(data, it, end);
+        }
+    }
+
+    std::array<char8_t, BLOCK_SIZE> tail{};
+    if(it != end) {
+        std::memcpy(tail.data(), it, static_cast<std::size_t>(end - it));
+    }
+
+    checker.check(tail.data());
+
+    if(checker.has_error()) {
+        return locate_error(data, it, end);
+    }
+
+    return size;
+}
+
+// Validates the input while summing `count_block` over it, where padding zeros must count one each.
+// Once the checker fails, the scalar decoder only has to find the error, so the sum handed to it is never returned.
+template<typename F>
+[[nodiscard]] auto measure(
+    const char8_t* const data,
+    const std::size_t    size,
+    F                    count_block
+) noexcept -> Expected<std::size_t> {
+    const char8_t*       it  = data;
+    const char8_t* const end = data + size;
+
+    Checker     checker{};
+    std::size_t result = 0U;
+
+    for(; static_cast<std::size_t>(end - it) >= BLOCK_SIZE; it += BLOCK_SIZE) {
+        checker.check(it);
+
+        if(checker.has_error()) {
+            return resume_length(data, it, end, result);
+        }
+
+        result += count_block(it);
+    }
+
+    const auto remaining = static_cast<std::size_t>(end - it);
+
+    std::array<char8_t, BLOCK_SIZE> tail{};
+    if(remaining != 0U) {
+        std::memcpy(tail.data(), it, remaining);
+    }
+
+    checker.check(tail.data());
+
+    if(checker.has_error()) {
+        return resume_length(data, it, end, result);
+    }
+
+    return result + count_block(tail.data()) - (BLOCK_SIZE - remaining);
+}
+
+[[nodiscard]] inline auto length(const char8_t* const data, const std::size_t size) noexcept -> Expected<std::size_t> {
+    return measure(data, size, &count_leading);
+}
+
+[[nodiscard]] inline auto utf16_length(const char8_t* const data, const std::size_t size) noexcept -> Expected<std::size_t> {
+    return measure(data, size, [](const char8_t* const block) noexcept -> std::size_t {
+        return count_leading(block) + count_supplementary(block);
+    });
+}
+
+[[nodiscard]] inline auto count(const char8_t* const data, const std::size_t size) noexcept -> std::size_t {
+    const char8_t*       it  = data;
+    const char8_t* const end = data + size;
+
+    std::size_t result = 0U;
+
+    for(; static_cast<std::size_t>(end - it) >= BLOCK_SIZE; it += BLOCK_SIZE) {
+        result += count_leading(it);
+    }
+
+    for(; it != end; ++it) {
+        result += is_continuation(*it) ? 0U : 1U;
+    }
+
+    return result;
+}
+
+// Decodes the at most 4 sequences at the front of 16 valid units into the lanes of `codepoints`.
+[[nodiscard]] inline auto decode_lanes(const __m128i input, __m128i& codepoints) noexcept -> Transcode {
+    const auto leading = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(input, _mm_set1_epi8(-65))));
+    const auto ends    = leading >> 1U & ((1U << decode_lookup::MASK_BITS) - 1U);
+
+    const auto& pattern = decode_lookup::PATTERNS[decode_lookup::KEYS[ends]];
+
+    const __m128i nibbles = _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F));
+    const __m128i payload = _mm_and_si128(
+        input,
+        _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(decode_lookup::PAYLOAD_MASKS.data())), nibbles)
+    );
+
+    // Each lane holds the payloads of one sequence, last unit lowest; squeeze out the 2 bit gaps between them.
+    const __m128i lanes = _mm_shuffle_epi8(
+        payload,
+        _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.shuffle.data()))
+    );
+
+    codepoints = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(lanes, _mm_set1_epi32(0x000000FF)),
+            _mm_and_si128(_mm_srli_epi32(lanes, 2), _mm_set1_epi32(0x00003FC0))
+        ),
+        _mm_or_si128(
+            _mm_and_si128(_mm_srli_epi32(lanes, 4), _mm_set1_epi32(0x000FF000)),
+            _mm_and_si128(_mm_srli_epi32(lanes, 6), _mm_set1_epi32(0x03FC0000))
+        )
+    );
+
+    return { pattern.consumed, pattern.count };
+}
+
+// Decodes the sequences at the front of the 16 valid units at `it` into `out`. Writes 4 slots even if fewer
+// codepoints are produced, or 16 if all units are ASCII.
+[[nodiscard]] inline auto decode_sequences(const char8_t* const it, char32_t* const out) noexcept -> Transcode {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+    if(_mm_movemask_epi8(input) == 0) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 0, _mm_cvtepu8_epi32(input));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 1, _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 2, _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 3, _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+
+        return { 16U, 16U };
+    }
+
+    __m128i codepoints;
+    const auto result = decode_lanes(input, codepoints);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), codepoints);
+
+    return result;
+}
+
+// As above, but to UTF-16. Codepoints that all fit a single unit are narrowed in one store of 4 slots,
+// anything else is split into surrogates lane by lane.
+[[nodiscard]] inline auto decode_sequences(const char8_t* const it, char16_t* const out) noexcept -> Transcode {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+
+    if(_mm_movemask_epi8(input) == 0) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 0, _mm_cvtepu8_epi16(input));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + 1, _mm_cvtepu8_epi16(_mm_srli_si128(input, 8)));
+
+        return { 16U, 16U };
+    }
+
+    __m128i codepoints;
+    const auto [read, count] = decode_lanes(input, codepoints);
+
+    if(_mm_testz_si128(codepoints, _mm_set1_epi32(static_cast<int>(0xFFFF0000U))) != 0) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi32(codepoints, codepoints));
+
+        return { read, count };
+    }
+
+    alignas(16) std::array<char32_t, 4U> lanes;
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes.data()), codepoints);
+
+    char16_t* dest = out;
+    for(std::size_t i = 0U; i < count; ++i) {
+        dest = write_utf16(lanes[i], dest);
+    }
+
+    return { read, static_cast<std::size_t>(dest - out) };
+}
+
+// Decodes valid units from `it` until it reaches `last`, possibly stepping past it. Reads a vector beyond `it`.
+template<typename T>
+auto decode_until(const char8_t*& it, const char8_t* const last, T*& dest) noexcept -> void {
+    while(it < last) {
+        const auto input = Simd::load(it);
+        if(!Simd::any_high_bit(input)) {
+            Simd::widen(input, dest);
+
+            it   += Simd::SIZE;
+            dest += Simd::SIZE;
+            continue;
+        }
+
+        const auto [read, written] = decode_sequences(it, dest);
+
+        it   += read;
+        dest += written;
+    }
+}
+
+// Decodes the valid units in [it, end), less than three blocks of them, from a zero padded copy into a local
+// buffer, so that short inputs take the vector path too. Each padding unit decodes to one unit. Returns the end of
+// the output.
+template<typename T>
+auto decode_padded(const char8_t* const it, const char8_t* const end, T* const dest) noexcept -> T* {
+    const auto remaining = static_cast<std::size_t>(end - it);
+
+    alignas(64) std::array<char8_t, 3U * BLOCK_SIZE> units{};
+    alignas(64) std::array<T, 3U * BLOCK_SIZE>       decoded;
+
+    if(remaining != 0U) {
+        std::memcpy(units.data(), it, remaining);
+    }
+
+    const char8_t* first = units.data();
+    T*             last  = decoded.data();
+
+    decode_until(first, units.data() + remaining, last);
+
+    const auto padding = static_cast<std::size_t>(first - units.data()) - remaining;
+    const auto written = static_cast<std::size_t>(last - decoded.data()) - padding;
+
+    return std::copy_n(decoded.data(), written, dest);
+}
+
+template<typename T>
+[[nodiscard]] auto decode_valid(const char8_t* const data, const std::size_t size, T* const out) noexcept -> Transcode {
+    const char8_t*       it    = data;
+    const char8_t* const end   = data + size;
+    const char8_t*       block = data;
+    T*                   dest  = out;
+
+    Checker checker{};
+
+    // Validation runs one block ahead: once a block passes, every sequence starting before it is known to be
+    // complete. Steps may then write a few slots past the units they produce, but those slots always
+    // belong to the validated codepoints that follow.
+    for(; static_cast<std::size_t>(end - block) >= BLOCK_SIZE; block += BLOCK_SIZE) {
+        checker.check(block);
+
+        if(checker.has_error()) {
+            break;
+        }
+
+        decode_until(it, block, dest);
+    }
+
+    // Less than two blocks are left, and once the zero padded tail validates they are decoded from a padded copy.
+    if(!checker.has_error()) {
+        std::array<char8_t, BLOCK_SIZE> tail{};
+        if(block != end) {
+            std::memcpy(tail.data(), block, static_cast<std::size_t>(end - block));
+        }
+
+        checker.check(tail.data());
+
+        if(!checker.has_error()) {
+            return { size, static_cast<std::size_t>(decode_padded(it, end, dest) - out) };
+        }
+    }
+
+    while(it != end) {
+        const auto [next, codepoint] = decode(it, end);
+        if(!codepoint) {
+            break;
+        }
+
+        if constexpr(std::same_as<T, char32_t>) {
+            *dest = *codepoint;
+            ++dest;
+        } else {
+            dest = write_utf16(*codepoint, dest);
+        }
+
+        it = next;
+    }
+
+    return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+}
+
+// As `decode_valid` for input known to be valid, which is decoded without being checked. While a whole block is
+// left past `it`, vectors read from it stay inside the input, and the slots written past the codepoints a step
+// produces belong to codepoints that follow.
+[[nodiscard]] auto decode_unchecked(const char8_t* const data, const std::size_t size, char32_t* const out) noexcept -> std::size_t {
+    const char8_t*       it   = data;
+    const char8_t* const end  = data + size;
+    char32_t*            dest = out;
+
+    if(size > BLOCK_SIZE) {
+        decode_until(it, end - BLOCK_SIZE, dest);
+    }
+
+    return static_cast<std::size_t>(decode_padded(it, end, dest) - out);
+}
+
+// Whether any of the `count` codepoints at `it`, a multiple of 4, is a surrogate or above U+10FFFF.
+[[nodiscard]] inline auto any_invalid(const char32_t* const it, const std::size_t count) noexcept -> bool {
+    const __m128i last           = _mm_set1_epi32(0x10FFFF);
+    const __m128i surrogate_span = _mm_set1_epi32(0x7FF);
+
+    __m128i invalid = _mm_setzero_si128();
+
+    for(std::size_t i = 0U; i < count; i += 4U) {
+        const __m128i codepoints = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + i));
+        const __m128i surrogate  = _mm_sub_epi32(codepoints, _mm_set1_epi32(0xD800));
+
+        invalid = _mm_or_si128(invalid, _mm_xor_si128(
+            _mm_cmpeq_epi32(_mm_max_epu32(codepoints, last), last),
+            _mm_set1_epi32(-1)
+        ));
+        invalid = _mm_or_si128(invalid, _mm_cmpeq_epi32(_mm_min_epu32(surrogate, surrogate_span), surrogate));
+    }
+
+    return _mm_testz_si128(invalid, invalid) == 0;
+}
+
+// Encodes 4 valid codepoints into `out`, writing 16 bytes regardless. Returns the number of units produced.
+[[nodiscard]] inline auto encode_codepoints(const __m128i codepoints, char8_t* const out) noexcept -> std::size_t {
+    const __m128i two   = _mm_cmpgt_epi32(codepoints, _mm_set1_epi32(0x7F));
+    const __m128i three = _mm_cmpgt_epi32(codepoints, _mm_set1_epi32(0x7FF));
+    const __m128i four  = _mm_cmpgt_epi32(codepoints, _mm_set1_epi32(0xFFFF));
+
+    // Six payload bits per byte, last unit lowest, then the headers for the lane's length.
+    const __m128i spread = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(codepoints, _mm_set1_epi32(0x0000003F)),
+            _mm_and_si128(_mm_slli_epi32(codepoints, 2), _mm_set1_epi32(0x00003F00))
+        ),
+        _mm_or_si128(
+            _mm_and_si128(_mm_slli_epi32(codepoints, 4), _mm_set1_epi32(0x003F0000)),
+            _mm_and_si128(_mm_slli_epi32(codepoints, 6), _mm_set1_epi32(0x3F000000))
+        )
+    );
+
+    const __m128i header = _mm_xor_si128(
+        _mm_and_si128(two, _mm_set1_epi32(0x0000C080)),
+        _mm_xor_si128(
+            _mm_and_si128(three, _mm_set1_epi32(0x00E08080 ^ 0x0000C080)),
+            _mm_and_si128(four, _mm_set1_epi32(static_cast<int>(0xF0808080U ^ 0x00E08080U)))
+        )
+    );
+
+    const __m128i units = _mm_blendv_epi8(codepoints, _mm_or_si128(spread, header), two);
+
+    // Lane lengths minus one, gathered into the low byte of each lane, then packed 2 bits per lane.
+    const __m128i extra  = _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(_mm_add_epi32(two, three), four));
+    const auto    packed = static_cast<std::uint32_t>(_mm_cvtsi128_si32(
+        _mm_shuffle_epi8(extra, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1))
+    ));
+    const auto index = (packed | packed >> 6U | packed >> 12U | packed >> 18U) & 0xFFU;
+
+    const auto& pattern = encode_lookup::PATTERNS[index];
+
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(out),
+        _mm_shuffle_epi8(units, _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.shuffle.data())))
+    );
+
+    return pattern.length;
+}
+
+[[nodiscard]] inline auto encode_valid(
+    const char32_t* const data,
+    const std::size_t     size,
+    char8_t* const        out
+) noexcept -> Transcode {
+    constexpr std::size_t CHUNK = 16U;
+
+    const char32_t*       it   = data;
+    const char32_t* const end  = data + size;
+    char8_t*              dest = out;
+
+    // Each chunk is only encoded once the chunk after it is known to be valid as well, so the bytes a step
+    // writes past its own units are always overwritten by valid output.
+    while(static_cast<std::size_t>(end - it) >= CHUNK * 2U && !any_invalid(it, CHUNK * 2U)) {
+        const auto     input = reinterpret_cast<const __m128i*>(it);
+        const __m128i  a     = _mm_loadu_si128(input + 0);
+        const __m128i  b     = _mm_loadu_si128(input + 1);
+        const __m128i  c     = _mm_loadu_si128(input + 2);
+        const __m128i  d     = _mm_loadu_si128(input + 3);
+        const __m128i  any   = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+
+        if(_mm_testz_si128(any, _mm_set1_epi32(~0x7F)) != 0) {
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dest),
+                _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d))
+            );
+
+            dest += CHUNK;
+        } else {
+            for(std::size_t i = 0U; i < CHUNK; i += 4U) {
+                dest += encode_codepoints(_mm_loadu_si128(reinterpret_cast<const __m128i*>(it + i)), dest);
+            }
+        }
+
+        it += CHUNK;
+    }
+
+    for(; it != end; ++it) {
+        if(is_invalid(*it)) {
+            break;
+        }
+
+        dest += simd::encode_valid(*it, dest);
+    }
+
+    return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+}
+
+// Whether any of the `count` units at `it`, a multiple of 8, is a surrogate.
+[[nodiscard]] inline auto any_surrogate(const char16_t* const it, const std::size_t count) noexcept -> bool {
+    __m128i surrogate = _mm_setzero_si128();
+
+    for(std::size_t i = 0U; i < count; i += 8U) {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + i));
+
+        surrogate = _mm_or_si128(surrogate, _mm_cmpeq_epi16(
+            _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800U))),
+            _mm_set1_epi16(static_cast<short>(0xD800U))
+        ));
+    }
+
+    return _mm_testz_si128(surrogate, surrogate) == 0;
+}
+
+[[nodiscard]] inline auto encode_valid_utf16(
+    const char16_t* const data,
+    const std::size_t     size,
+    char8_t* const        out
+) noexcept -> Transcode {
+    constexpr std::size_t CHUNK = 16U;
+
+    const char16_t*       it   = data;
+    const char16_t* const end  = data + size;
+    char8_t*              dest = out;
+
+    // As in `encode_valid`, a chunk is only encoded in registers when the chunk after it has no surrogates either.
+    // Chunks with surrogates are encoded one codepoint at a time.
+    while(static_cast<std::size_t>(end - it) >= CHUNK * 2U) {
+        if(any_surrogate(it, CHUNK * 2U)) {
+            for(const char16_t* const stop = it + CHUNK; it < stop;) {
+                const auto [next, codepoint] = read_utf16(it, end);
+                if(!codepoint) {
+                    return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+                }
+
+                dest += simd::encode_valid(*codepoint, dest);
+
+                it = next;
+            }
+
+            continue;
+        }
+
+        const auto    input = reinterpret_cast<const __m128i*>(it);
+        const __m128i low   = _mm_loadu_si128(input + 0);
+        const __m128i high  = _mm_loadu_si128(input + 1);
+
+        if(_mm_testz_si128(_mm_or_si128(low, high), _mm_set1_epi16(~0x7F)) != 0) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_packus_epi16(low, high));
+
+            dest += CHUNK;
+        } else {
+            dest += encode_codepoints(_mm_cvtepu16_epi32(low), dest);
+            dest += encode_codepoints(_mm_cvtepu16_epi32(_mm_srli_si128(low, 8)), dest);
+            dest += encode_codepoints(_mm_cvtepu16_epi32(high), dest);
+            dest += encode_codepoints(_mm_cvtepu16_epi32(_mm_srli_si128(high, 8)), dest);
+        }
+
+        it += CHUNK;
+    }
+
+    while(it != end) {
+        const auto [next, codepoint] = read_utf16(it, end);
+        if(!codepoint) {
+            break;
+        }
+
+        dest += simd::encode_valid(*codepoint, dest);
+
+        it = next;
+    }
+
+    return { static_cast<std::size_t>(it - data), static_cast<std::size_t>(dest - out) };
+}
+
+inline constexpr Kernels KERNELS = {
+    .isa          = ISA,
+    .validate     = &validate,
+    .valid_prefix = &valid_prefix,
+    .length       = &length,
+    .count        = &count,
+    .decode_valid = &decode_valid<char32_t>,
+    .encode_valid = &encode_valid,
+
+    .decode_unchecked = &decode_unchecked,
+
+    .utf16_length       = &utf16_length,
+    .decode_valid_utf16 = &decode_valid<char16_t>,
+    .encode_valid_utf16 = &encode_valid_utf16,
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "common.hpp"
+
+#if UTF8_X86
+
+UTF8_TARGET_PUSH(UTF8_TARGET_SSE42)
+
+namespace utf8::detail::simd {
+    struct Sse42 {
+        using Register = __m128i;
+
+        static constexpr std::size_t SIZE = 16U;
+
+        [[nodiscard]] static auto zero() noexcept -> Register {
+            return _mm_setzero_si128();
+        }
+
+        [[nodiscard]] static auto splat(const std::uint8_t value) noexcept -> Register {
+            return _mm_set1_epi8(static_cast<char>(value));
+        }
+
+        [[nodiscard]] static auto load(const void* const data) noexcept -> Register {
+            return _mm_loadu_si128(static_cast<const Register*>(data));
+        }
+
+        [[nodiscard]] static auto load_last(const std::uint8_t* const block) noexcept -> Register {
+            return load(block + BLOCK_SIZE - SIZE);
+        }
+
+        [[nodiscard]] static auto table(const std::uint8_t* const table) noexcept -> Register {
+            return load(table);
+        }
+
+        [[nodiscard]] static auto bit_or(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm_or_si128(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_and(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm_and_si128(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto bit_xor(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm_xor_si128(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto saturating_sub(const Register lhs, const Register rhs) noexcept -> Register {
+            return _mm_subs_epu8(lhs, rhs);
+        }
+
+        [[nodiscard]] static auto shift_right_4(const Register value) noexcept -> Register {
+            return _mm_and_si128(_mm_srli_epi16(value, 4), splat(0x0FU));
+        }
+
+        [[nodiscard]] static auto lookup(const Register table, const Register index) noexcept -> Register {
+            return _mm_shuffle_epi8(table, index);
+        }
+
+        template<int N>
+        [[nodiscard]] static auto prev(const Register input, const Register prev_input) noexcept -> Register {
+            return _mm_alignr_epi8(input, prev_input, 16 - N);
+        }
+
+        // Bit per unit that is not a continuation unit, i.e. signed greater than 0xBF.
+        [[nodiscard]] static auto leading_bits(const Register value) noexcept -> std::uint64_t {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(value, splat(0xBFU))));
+        }
+
+        // Zero-extends every unit of an all-ASCII register into a codepoint or UTF-16 unit.
+        static auto widen(const Register value, char32_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m128i*>(out);
+
+            _mm_storeu_si128(dest + 0, _mm_cvtepu8_epi32(value));
+            _mm_storeu_si128(dest + 1, _mm_cvtepu8_epi32(_mm_srli_si128(value, 4)));
+            _mm_storeu_si128(dest + 2, _mm_cvtepu8_epi32(_mm_srli_si128(value, 8)));
+            _mm_storeu_si128(dest + 3, _mm_cvtepu8_epi32(_mm_srli_si128(value, 12)));
+        }
+
+        static auto widen(const Register value, char16_t* const out) noexcept -> void {
+            const auto dest = reinterpret_cast<__m128i*>(out);
+
+            _mm_storeu_si128(dest + 0, _mm_cvtepu8_epi16(value));
+            _mm_storeu_si128(dest + 1, _mm_cvtepu8_epi16(_mm_srli_si128(value, 8)));
+        }
+
+        // Bit per unit with its high bit set.
+        [[nodiscard]] static auto high_bits(const Register value) noexcept -> std::uint64_t {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(value));
+        }
+
+        [[nodiscard]] static auto any_high_bit(const Register value) noexcept -> bool {
+            return _mm_movemask_epi8(value) != 0;
+        }
+
+        [[nodiscard]] static auto any_bit(const Register value) noexcept -> bool {
+            return _mm_testz_si128(value, value) == 0;
+        }
+    };
+}
+
+UTF8_TARGET_POP()
+
+#endif
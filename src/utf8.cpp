@@ -1 +1,501 @@
 #include <utf8/utf8.hpp>
+
+#include "simd/common.hpp"
+#include "simd/fallback.hpp"
+#include "simd/sse42.hpp"
+#include "simd/avx2.hpp"
+#include "simd/avx512.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#if UTF8_X86 && defined(_MSC_VER)
+    #include <intrin.h>
+#elif UTF8_X86
+    #include <cpuid.h>
+#endif
+
+#if UTF8_X86
+
+UTF8_TARGET_PUSH(UTF8_TARGET_SSE42)
+
+namespace utf8::detail::simd::sse42 {
+    using Simd = Sse42;
+
+    inline constexpr Isa ISA = Isa::Sse42;
+
+    #include "simd/kernels.hpp"
+}
+
+UTF8_TARGET_POP()
+
+UTF8_TARGET_PUSH(UTF8_TARGET_AVX2)
+
+namespace utf8::detail::simd::avx2 {
+    using Simd = Avx2;
+
+    inline constexpr Isa ISA = Isa::Avx2;
+
+    #include "simd/kernels.hpp"
+}
+
+UTF8_TARGET_POP()
+
+UTF8_TARGET_PUSH(UTF8_TARGET_AVX512)
+
+namespace utf8::detail::simd::avx512 {
+    using Simd = Avx512;
+
+    inline constexpr Isa ISA = Isa::Avx512;
+
+    #include "simd/kernels.hpp"
+}
+
+UTF8_TARGET_POP()
+
+#endif
+
+namespace utf8::detail::simd {
+    namespace {
+        // Fewest codepoints worth stepping over with the vector kernel rather than unit by unit.
+        constexpr std::size_t MIN_VECTOR_SKIP = 64U;
+
+#if UTF8_X86
+        struct Registers {
+            std::uint32_t eax;
+            std::uint32_t ebx;
+            std::uint32_t ecx;
+            std::uint32_t edx;
+        };
+
+        [[nodiscard]] auto cpuid(const std::uint32_t leaf, const std::uint32_t subleaf = 0U) noexcept -> Registers {
+            Registers result{};
+#if defined(_MSC_VER)
+            int registers[4U];
+            __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+            result = {
+                static_cast<std::uint32_t>(registers[0U]),
+                static_cast<std::uint32_t>(registers[1U]),
+                static_cast<std::uint32_t>(registers[2U]),
+                static_cast<std::uint32_t>(registers[3U]),
+            };
+#else
+            __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+#endif
+            return result;
+        }
+
+        // Register state the operating system saves on context switches.
+        [[nodiscard]] auto xgetbv() noexcept -> std::uint64_t {
+#if defined(_MSC_VER)
+            return _xgetbv(0U);
+#else
+            std::uint32_t eax;
+            std::uint32_t edx;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0U));
+
+            return static_cast<std::uint64_t>(edx) << 32U | eax;
+#endif
+        }
+
+        [[nodiscard]] auto detect() noexcept -> Isa {
+            constexpr auto bit = [](const std::uint32_t value, const unsigned index) noexcept -> bool {
+                return (value >> index & 1U) != 0U;
+            };
+
+            // SSE4.2 is reported in leaf 1, so only AVX2 and AVX-512 need leaf 7.
+            const std::uint32_t max_leaf = cpuid(0U).eax;
+            if(max_leaf < 1U) {
+                return Isa::Fallback;
+            }
+
+            const auto leaf_1 = cpuid(1U);
+
+            const bool ssse3  = bit(leaf_1.ecx, 9U);
+            const bool sse41  = bit(leaf_1.ecx, 19U);
+            const bool sse42  = bit(leaf_1.ecx, 20U);
+            const bool popcnt = bit(leaf_1.ecx, 23U);
+
+            if(!(ssse3 && sse41 && sse42 && popcnt)) {
+                return Isa::Fallback;
+            }
+
+            const bool osxsave = bit(leaf_1.ecx, 27U);
+            const bool avx     = bit(leaf_1.ecx, 28U);
+            if(!(osxsave && avx) || max_leaf < 7U || cpuid(0x80000000U).eax < 0x80000001U) {
+                return Isa::Sse42;
+            }
+
+            const auto leaf_7 = cpuid(7U);
+
+            constexpr std::uint64_t YMM_STATE = 0x06U;
+            constexpr std::uint64_t ZMM_STATE = 0xE6U;
+
+            const auto state = xgetbv();
+
+            const bool bmi1  = bit(leaf_7.ebx, 3U);
+            const bool avx2  = bit(leaf_7.ebx, 5U);
+            const bool bmi2  = bit(leaf_7.ebx, 8U);
+            const bool lzcnt = bit(cpuid(0x80000001U).ecx, 5U);
+
+            if(!(avx2 && bmi1 && bmi2 && lzcnt) || (state & YMM_STATE) != YMM_STATE) {
+                return Isa::Sse42;
+            }
+
+            const bool avx512f  = bit(leaf_7.ebx, 16U);
+            const bool avx512bw = bit(leaf_7.ebx, 30U);
+            const bool avx512vl = bit(leaf_7.ebx, 31U);
+
+            if(!(avx512f && avx512bw && avx512vl) || (state & ZMM_STATE) != ZMM_STATE) {
+                return Isa::Avx2;
+            }
+
+            return Isa::Avx512;
+        }
+#else
+        [[nodiscard]] auto detect() noexcept -> Isa {
+            return Isa::Fallback;
+        }
+#endif
+
+        [[nodiscard]] auto kernels_for(const Isa isa) noexcept -> const Kernels& {
+            switch(isa) {
+#if UTF8_X86
+                case Isa::Sse42:
+                    return sse42::KERNELS;
+                case Isa::Avx2:
+                    return avx2::KERNELS;
+                case Isa::Avx512:
+                    return avx512::KERNELS;
+#endif
+                default:
+                    return fallback::KERNELS;
+            }
+        }
+
+        [[nodiscard]] auto detected() noexcept -> Isa {
+            static const Isa isa = detect();
+
+            return isa;
+        }
+
+        constinit std::atomic<const Kernels*> active_kernels{ nullptr };
+
+        [[nodiscard]] auto kernels() noexcept -> const Kernels& {
+            const Kernels* result = active_kernels.load(std::memory_order_relaxed);
+            if(result == nullptr) {
+                result = &kernels_for(detected());
+
+                active_kernels.store(result, std::memory_order_relaxed);
+            }
+
+            return *result;
+        }
+
+        // Resolve dispatch during static initialization so the first call does not pay for cpuid.
+        [[maybe_unused]] const Kernels& startup_kernels = kernels();
+    }
+
+    auto validate(const std::span<const char8_t> input) noexcept -> bool {
+        return kernels().validate(input.data(), input.size());
+    }
+
+    auto valid_prefix(const std::span<const char8_t> input) noexcept -> std::size_t {
+        return kernels().valid_prefix(input.data(), input.size());
+    }
+
+    auto length(const std::span<const char8_t> input) noexcept -> Expected<std::size_t> {
+        return kernels().length(input.data(), input.size());
+    }
+
+    auto count(const std::span<const char8_t> input) noexcept -> std::size_t {
+        return kernels().count(input.data(), input.size());
+    }
+
+    // No more than `count` codepoints start in the next `count` units, so while many are left, whole runs of that
+    // many units are counted by the vector kernel without overshooting.
+    auto skip(const std::span<const char8_t> input, const std::size_t count) noexcept -> Skip {
+        const auto& active = kernels();
+
+        std::size_t offset  = 0U;
+        std::size_t skipped = 0U;
+
+        while(count - skipped >= MIN_VECTOR_SKIP && offset < input.size()) {
+            const std::size_t run = std::min(count - skipped, input.size() - offset);
+
+            skipped += active.count(input.data() + offset, run);
+            offset  += run;
+        }
+
+        for(; offset < input.size(); ++offset) {
+            if(is_continuation(input[offset])) {
+                continue;
+            }
+
+            if(skipped == count) {
+                break;
+            }
+
+            ++skipped;
+        }
+
+        return { offset, skipped };
+    }
+
+    auto decoded_length(const std::span<const char8_t> input) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        if(const auto length = active.length(input.data(), input.size())) {
+            return *length;
+        }
+
+        const char8_t*       it  = input.data();
+        const char8_t* const end = input.data() + input.size();
+
+        std::size_t result = 0U;
+
+        while(true) {
+            const auto read = active.valid_prefix(it, static_cast<std::size_t>(end - it));
+
+            result += active.count(it, read);
+            it     += read;
+
+            if(it == end) {
+                break;
+            }
+
+            it = decode(it, end).first;
+
+            ++result;
+        }
+
+        return result;
+    }
+
+    // Branch free, so that the loop is vectorized. Surrogates take 3 units like the replacement, and so does
+    // anything above U+10FFFF, which is excluded from the 4 unit range.
+    auto encoded_length(const std::span<const char32_t> input) noexcept -> std::size_t {
+        std::size_t result = 0U;
+
+        for(const char32_t codepoint : input) {
+            result += 1U;
+            result += codepoint > 0x7FU ? 1U : 0U;
+            result += codepoint > 0x7FFU ? 1U : 0U;
+            result += codepoint > 0xFFFFU && codepoint <= 0x10FFFFU ? 1U : 0U;
+        }
+
+        return result;
+    }
+
+    auto repaired_length(const std::span<const char8_t> input) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        const char8_t*       it  = input.data();
+        const char8_t* const end = input.data() + input.size();
+
+        std::size_t result = 0U;
+
+        while(true) {
+            const auto read = active.valid_prefix(it, static_cast<std::size_t>(end - it));
+
+            result += read;
+            it     += read;
+
+            if(it == end) {
+                break;
+            }
+
+            it = decode(it, end).first;
+
+            result += REPLACEMENT_UNITS.size();
+        }
+
+        return result;
+    }
+
+    auto decode_all(const std::span<const char8_t> input, char32_t* const out) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        const char8_t*       it   = input.data();
+        const char8_t* const end  = input.data() + input.size();
+        char32_t*            dest = out;
+
+        while(true) {
+            const auto [read, written] = active.decode_valid(it, static_cast<std::size_t>(end - it), dest);
+
+            it   += read;
+            dest += written;
+
+            if(it == end) {
+                break;
+            }
+
+            it = decode(it, end).first;
+
+            *dest = REPLACEMENT;
+            ++dest;
+        }
+
+        return static_cast<std::size_t>(dest - out);
+    }
+
+    auto decode_unchecked(const std::span<const char8_t> input, char32_t* const out) noexcept -> std::size_t {
+        return kernels().decode_unchecked(input.data(), input.size(), out);
+    }
+
+    auto decode_strict(
+        const std::span<const char8_t> input,
+        char32_t* const                out
+    ) noexcept -> Strict {
+        const auto [read, written] = kernels().decode_valid(input.data(), input.size(), out);
+        if(read == input.size()) {
+            return { read, written, {} };
+        }
+
+        return { read, written, Unexpected{ decode(input.data() + read, input.data() + input.size()).second.error() } };
+    }
+
+    auto encode_all(const std::span<const char32_t> input, char8_t* const out) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        const char32_t*       it   = input.data();
+        const char32_t* const end  = input.data() + input.size();
+        char8_t*              dest = out;
+
+        while(true) {
+            const auto [read, written] = active.encode_valid(it, static_cast<std::size_t>(end - it), dest);
+
+            it   += read;
+            dest += written;
+
+            if(it == end) {
+                break;
+            }
+
+            dest = std::ranges::copy(REPLACEMENT_UNITS, dest).out;
+
+            ++it;
+        }
+
+        return static_cast<std::size_t>(dest - out);
+    }
+
+    auto encode_strict(
+        const std::span<const char32_t> input,
+        char8_t* const                  out
+    ) noexcept -> Strict {
+        const auto [read, written] = kernels().encode_valid(input.data(), input.size(), out);
+        if(read == input.size()) {
+            return { read, written, {} };
+        }
+
+        return { read, written, Unexpected{ Error::InvalidCodepoint } };
+    }
+
+    auto utf16_length(const std::span<const char8_t> input) noexcept -> Expected<std::size_t> {
+        return kernels().utf16_length(input.data(), input.size());
+    }
+
+    auto decode_utf16(const std::span<const char8_t> input, char16_t* const out) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        const char8_t*       it   = input.data();
+        const char8_t* const end  = input.data() + input.size();
+        char16_t*            dest = out;
+
+        while(true) {
+            const auto [read, written] = active.decode_valid_utf16(it, static_cast<std::size_t>(end - it), dest);
+
+            it   += read;
+            dest += written;
+
+            if(it == end) {
+                break;
+            }
+
+            it = decode(it, end).first;
+
+            *dest = static_cast<char16_t>(REPLACEMENT);
+            ++dest;
+        }
+
+        return static_cast<std::size_t>(dest - out);
+    }
+
+    auto decode_utf16_strict(
+        const std::span<const char8_t> input,
+        char16_t* const                out
+    ) noexcept -> Strict {
+        const auto [read, written] = kernels().decode_valid_utf16(input.data(), input.size(), out);
+        if(read == input.size()) {
+            return { read, written, {} };
+        }
+
+        return { read, written, Unexpected{ decode(input.data() + read, input.data() + input.size()).second.error() } };
+    }
+
+    auto encode_utf16(const std::span<const char16_t> input, char8_t* const out) noexcept -> std::size_t {
+        const auto& active = kernels();
+
+        const char16_t*       it   = input.data();
+        const char16_t* const end  = input.data() + input.size();
+        char8_t*              dest = out;
+
+        while(true) {
+            const auto [read, written] = active.encode_valid_utf16(it, static_cast<std::size_t>(end - it), dest);
+
+            it   += read;
+            dest += written;
+
+            if(it == end) {
+                break;
+            }
+
+            dest = std::ranges::copy(REPLACEMENT_UNITS, dest).out;
+
+            ++it;
+        }
+
+        return static_cast<std::size_t>(dest - out);
+    }
+
+    auto encode_utf16_strict(
+        const std::span<const char16_t> input,
+        char8_t* const                  out
+    ) noexcept -> Strict {
+        const auto [read, written] = kernels().encode_valid_utf16(input.data(), input.size(), out);
+        if(read == input.size()) {
+            return { read, written, {} };
+        }
+
+        return { read, written, Unexpected{ Error::InvalidCodepoint } };
+    }
+}
+
+namespace utf8 {
+    auto active_isa() noexcept -> Isa {
+        return detail::simd::kernels().isa;
+    }
+
+    auto best_isa() noexcept -> Isa {
+        return detail::simd::detected();
+    }
+
+    auto is_supported(const Isa isa) noexcept -> bool {
+        return std::to_underlying(isa) <= std::to_underlying(best_isa());
+    }
+
+    auto force_isa(const Isa isa) noexcept -> bool {
+        if(!is_supported(isa)) {
+            return false;
+        }
+
+        detail::simd::active_kernels.store(&detail::simd::kernels_for(isa), std::memory_order_relaxed);
+
+        return true;
+    }
+}
@@ -0,0 +1,785 @@
+#include <gtest/gtest.h>
+
+#include <utf8/algorithm.hpp>
+#include <utf8/ranges.hpp>
+#include <utf8/simd.hpp>
+#include <utf8/validation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+    template<typename F>
+    auto for_each_isa(F&& test) -> void {
+        for(const auto isa : { utf8::Isa::Fallback, utf8::Isa::Sse42, utf8::Isa::Avx2, utf8::Isa::Avx512 }) {
+            if(!utf8::force_isa(isa)) {
+                continue;
+            }
+
+            SCOPED_TRACE(testing::Message() << "isa " << static_cast<int>(isa));
+
+            test();
+        }
+
+        utf8::force_isa(utf8::best_isa());
+    }
+
+    auto reference_is_valid(const std::span<const char8_t> input) noexcept -> bool {
+        auto       it  = input.begin();
+        const auto end = input.end();
+
+        while(it != end) {
+            auto [new_it, codepoint] = utf8::decode(it, end);
+            if(!codepoint) {
+                return false;
+            }
+
+            it = new_it;
+        }
+
+        return true;
+    }
+
+    auto random_text(std::mt19937& engine, const std::size_t size, const double invalid_ratio) -> std::u8string {
+        static constexpr std::array<char32_t, 10U> codepoints = {
+            U'a', U'~', U'\u00E9', U'\u07FF', U'\u0800', U'\uD7FF', U'\uE000', U'\uFFFD', U'\U00010000', U'\U0010FFFF',
+        };
+
+        std::uniform_int_distribution<std::size_t> pick{ 0U, codepoints.size() - 1U };
+        std::uniform_int_distribution<int>         byte{ 0, 255 };
+        std::bernoulli_distribution                corrupt{ invalid_ratio };
+
+        std::u8string result;
+        while(result.size() < size) {
+            if(corrupt(engine)) {
+                result.push_back(static_cast<char8_t>(byte(engine)));
+                continue;
+            }
+
+            const auto units = *utf8::encode(codepoints[pick(engine)]);
+            result.append(units.begin(), units.end());
+        }
+
+        return result;
+    }
+
+    auto random_codepoints(std::mt19937& engine, const std::size_t size, const double invalid_ratio) -> std::u32string {
+        static constexpr std::array<char32_t, 10U> codepoints = {
+            U'a', U'~', U'\u00E9', U'\u07FF', U'\u0800', U'\uD7FF', U'\uE000', U'\uFFFD', U'\U00010000', U'\U0010FFFF',
+        };
+        static constexpr std::array<char32_t, 5U> invalid = {
+            0xD800U, 0xDFFFU, 0x110000U, 0x7FFFFFFFU, 0xFFFFFFFFU,
+        };
+
+        std::uniform_int_distribution<std::size_t> pick{ 0U, codepoints.size() - 1U };
+        std::uniform_int_distribution<std::size_t> pick_invalid{ 0U, invalid.size() - 1U };
+        std::bernoulli_distribution                ascii{ 0.5 };
+        std::bernoulli_distribution                corrupt{ invalid_ratio };
+
+        std::u32string result;
+        while(result.size() < size) {
+            if(corrupt(engine)) {
+                result.push_back(invalid[pick_invalid(engine)]);
+            } else {
+                result.push_back(ascii(engine) ? U'x' : codepoints[pick(engine)]);
+            }
+        }
+
+        return result;
+    }
+
+    auto random_utf16(std::mt19937& engine, const std::size_t size, const double invalid_ratio) -> std::u16string {
+        std::uniform_int_distribution<int> surrogate{ 0xD800, 0xDFFF };
+        std::bernoulli_distribution        corrupt{ invalid_ratio };
+
+        std::u16string result;
+        for(const char32_t codepoint : random_codepoints(engine, size, 0.0)) {
+            if(corrupt(engine)) {
+                result.push_back(static_cast<char16_t>(surrogate(engine)));
+            }
+
+            utf8::detail::write_utf16(codepoint, std::back_inserter(result));
+        }
+
+        return result;
+    }
+}
+
+TEST(Utf8AlgorithmTests, is_valid_edge_cases) {
+    static constexpr auto test_case = [](std::initializer_list<char8_t> input) noexcept -> void {
+        const std::span<const char8_t> span{ input.begin(), input.size() };
+
+        for_each_isa([&] {
+            EXPECT_EQ(utf8::ranges::is_valid(span), reference_is_valid(span));
+        });
+    };
+
+    test_case({});
+    test_case({ 0x7FU });
+    test_case({ 0xC2U, 0x80U });
+    test_case({ 0xC1U, 0xBFU });
+    test_case({ 0xE0U, 0x9FU, 0xBFU });
+    test_case({ 0xE0U, 0xA0U, 0x80U });
+    test_case({ 0xEDU, 0x9FU, 0xBFU });
+    test_case({ 0xEDU, 0xA0U, 0x80U });
+    test_case({ 0xF0U, 0x8FU, 0xBFU, 0xBFU });
+    test_case({ 0xF0U, 0x90U, 0x80U, 0x80U });
+    test_case({ 0xF4U, 0x8FU, 0xBFU, 0xBFU });
+    test_case({ 0xF4U, 0x90U, 0x80U, 0x80U });
+    test_case({ 0xF5U, 0x80U, 0x80U, 0x80U });
+    test_case({ 0xF8U, 0x88U, 0x80U, 0x80U, 0x80U });
+    test_case({ 0xE2U, 0x82U });
+    test_case({ 0x80U });
+}
+
+TEST(Utf8AlgorithmTests, is_valid_all_sequences) {
+    // Every two byte prefix followed by every kind of continuation, placed at every offset of a block.
+    std::vector<char8_t> buffer(80U, u8'a');
+
+    for(std::size_t offset : { 0U, 13U, 61U, 62U, 63U, 76U }) {
+        for(int first = 0x80; first <= 0xFF; ++first) {
+            for(int second = 0x00; second <= 0xFF; second += 0x0F) {
+                for(char8_t third : { 0x41U, 0x80U, 0xBFU, 0xC0U }) {
+                    std::ranges::fill(buffer, u8'a');
+
+                    const auto available = buffer.size() - offset;
+
+                    buffer[offset] = static_cast<char8_t>(first);
+                    if(available > 1U) {
+                        buffer[offset + 1U] = static_cast<char8_t>(second);
+                    }
+                    if(available > 2U) {
+                        buffer[offset + 2U] = third;
+                    }
+                    if(available > 3U) {
+                        buffer[offset + 3U] = 0x80U;
+                    }
+
+                    const bool expected = reference_is_valid(buffer);
+
+                    for_each_isa([&] {
+                        ASSERT_EQ(utf8::ranges::is_valid(buffer), expected)
+                            << "offset " << offset << ", bytes " << first << ' ' << second << ' ' << int{ third };
+                    });
+                }
+            }
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, is_valid_random) {
+    std::mt19937 engine{ 42U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01 }) {
+        for(std::size_t size = 0U; size < 300U; ++size) {
+            const auto text     = random_text(engine, size, ratio);
+            const bool expected = reference_is_valid(text);
+
+            for_each_isa([&] {
+                ASSERT_EQ(utf8::ranges::is_valid(text), expected);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, ascii_runs_match_scalar_path) {
+    std::mt19937 engine{ 7U };
+
+    for(const double ratio : { 0.0, 0.01 }) {
+        for(std::size_t size = 0U; size < 200U; size += 7U) {
+            auto text = random_text(engine, size, ratio);
+            text.insert(size / 2U, u8"plain ASCII text that spans more than one 32 byte block");
+
+            // std::list forces the unit-at-a-time path.
+            const std::list<char8_t> list{ text.begin(), text.end() };
+
+            EXPECT_EQ(utf8::ranges::length(text), utf8::ranges::length(list));
+
+            std::u8string repaired;
+            std::u8string repaired_list;
+            utf8::ranges::repair(text, std::back_inserter(repaired));
+            utf8::ranges::repair(list, std::back_inserter(repaired_list));
+            EXPECT_EQ(repaired, repaired_list);
+
+            std::u32string decoded;
+            std::u32string decoded_list;
+            utf8::ranges::decode_all(text, std::back_inserter(decoded));
+            utf8::ranges::decode_all(list, std::back_inserter(decoded_list));
+            EXPECT_EQ(decoded, decoded_list);
+
+            std::u32string strict;
+            std::u32string strict_list;
+            const auto [strict_out, strict_result]           = utf8::ranges::decode_strict(text, std::back_inserter(strict));
+            const auto [strict_list_out, strict_list_result] = utf8::ranges::decode_strict(list, std::back_inserter(strict_list));
+            EXPECT_EQ(strict, strict_list);
+            EXPECT_EQ(strict_result.has_value(), strict_list_result.has_value());
+
+            const std::list<char32_t> decoded_as_list{ decoded.begin(), decoded.end() };
+
+            std::u8string encoded;
+            std::u8string encoded_list;
+            utf8::ranges::encode_all(decoded, std::back_inserter(encoded));
+            utf8::ranges::encode_all(decoded_as_list, std::back_inserter(encoded_list));
+            EXPECT_EQ(encoded, encoded_list);
+            EXPECT_EQ(encoded, repaired);
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, length_matches_scalar_path) {
+    std::mt19937 engine{ 11U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 300U; ++size) {
+            const auto               text = random_text(engine, size, ratio);
+            const std::list<char8_t> list{ text.begin(), text.end() };
+
+            const auto expected = utf8::ranges::length(list);
+
+            for_each_isa([&] {
+                ASSERT_EQ(utf8::ranges::length(text), expected);
+
+                if(expected) {
+                    ASSERT_EQ(utf8::ranges::length_unchecked(text), *expected);
+                }
+            });
+
+            if(expected) {
+                ASSERT_EQ(utf8::ranges::length_unchecked(list), *expected);
+            }
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, length_error) {
+    static constexpr auto test_case = [](std::u8string input, const utf8::Error expected_error) -> void {
+        // Move the error across block boundaries behind a valid multi-byte prefix.
+        for(std::size_t padding = 0U; padding < 140U; ++padding) {
+            for(const std::u8string suffix : { u8"", u8"tail" }) {
+                std::u8string text;
+                while(text.size() < padding) {
+                    text += u8"é";
+                }
+                text += input;
+                text += suffix;
+
+                for_each_isa([&] {
+                    const auto length = utf8::ranges::length(text);
+
+                    ASSERT_FALSE(length.has_value());
+                    EXPECT_EQ(length.error(), expected_error);
+                });
+            }
+        }
+    };
+
+    test_case({ 0xC0U, 0xAFU }, utf8::Error::OverlongEncoding);
+    test_case({ 0xEDU, 0xA0U, 0x80U }, utf8::Error::InvalidCodepoint);
+    test_case({ 0xF4U, 0x90U, 0x80U, 0x80U }, utf8::Error::InvalidCodepoint);
+    test_case({ 0xE2U, 0x82U }, utf8::Error::InvalidByteSequence);
+    test_case({ 0xFFU }, utf8::Error::InvalidByteSequence);
+}
+
+TEST(Utf8AlgorithmTests, length_error_before_block_boundary) {
+    // The checker may only flag an ill-formed unit in the next block, when a valid sequence after it crosses the
+    // boundary, so the scalar decoder has to resume before it.
+    for(const std::u8string_view next : { u8"\u00E9", u8"\u20AC", u8"\U0001F600" }) {
+        for(const std::u8string_view padding : { u8"a", u8"\u00E9" }) {
+            for(std::size_t size = 0U; size < 140U; ++size) {
+                std::u8string text;
+                while(text.size() < size) {
+                    text += text.size() + padding.size() <= size ? padding : u8"a";
+                }
+                text += u8"\xFF";
+                text += next;
+                text += u8"tail";
+
+                for_each_isa([&] {
+                    const auto length = utf8::ranges::length(text);
+
+                    ASSERT_FALSE(length.has_value()) << "size " << size;
+                    EXPECT_EQ(length.error(), utf8::Error::InvalidByteSequence);
+                });
+            }
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, decode_matches_scalar_path) {
+    std::mt19937 engine{ 13U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 400U; size += 3U) {
+            const auto               text = random_text(engine, size, ratio);
+            const std::list<char8_t> list{ text.begin(), text.end() };
+
+            std::u32string expected_all = U"prefix";
+            utf8::ranges::decode_all(list, std::back_inserter(expected_all));
+
+            std::u32string expected_strict = U"prefix";
+            const auto [expected_out, expected_result] =
+                utf8::ranges::decode_strict(list, std::back_inserter(expected_strict));
+
+            for_each_isa([&] {
+                std::u32string all = U"prefix";
+                utf8::ranges::decode_all(text, std::back_inserter(all));
+                ASSERT_EQ(all, expected_all);
+
+                // Exactly as large as the output, so that any write past it is caught by sanitizers.
+                std::vector<char32_t> buffer(expected_all.size() - 6U);
+                const auto            end = utf8::ranges::decode_all(text, buffer.data());
+                ASSERT_EQ(end, buffer.data() + buffer.size());
+                ASSERT_TRUE(std::ranges::equal(buffer, std::u32string_view{ expected_all }.substr(6U)));
+
+                std::u32string strict = U"prefix";
+                const auto [out, result] = utf8::ranges::decode_strict(text, std::back_inserter(strict));
+                ASSERT_EQ(strict, expected_strict);
+                ASSERT_EQ(result, expected_result);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, encode_matches_scalar_path) {
+    std::mt19937 engine{ 17U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 200U; ++size) {
+            const auto                text = random_codepoints(engine, size, ratio);
+            const std::list<char32_t> list{ text.begin(), text.end() };
+
+            std::u8string expected_all = u8"prefix";
+            utf8::ranges::encode_all(list, std::back_inserter(expected_all));
+
+            std::u8string expected_strict = u8"prefix";
+            const auto [expected_out, expected_result] =
+                utf8::ranges::encode_strict(list, std::back_inserter(expected_strict));
+
+            for_each_isa([&] {
+                std::u8string all = u8"prefix";
+                utf8::ranges::encode_all(text, std::back_inserter(all));
+                ASSERT_EQ(all, expected_all);
+
+                // Exactly as large as the output, so that any write past it is caught by sanitizers.
+                std::vector<char8_t> buffer(expected_all.size() - 6U);
+                const auto           end = utf8::ranges::encode_all(text, buffer.data());
+                ASSERT_EQ(end, buffer.data() + buffer.size());
+                ASSERT_TRUE(std::ranges::equal(buffer, std::u8string_view{ expected_all }.substr(6U)));
+
+                std::u8string strict = u8"prefix";
+                const auto [out, result] = utf8::ranges::encode_strict(text, std::back_inserter(strict));
+                ASSERT_EQ(strict, expected_strict);
+                ASSERT_EQ(result, expected_result);
+
+                std::vector<char8_t> strict_buffer(expected_strict.size() - 6U);
+                const auto [strict_end, strict_result] = utf8::ranges::encode_strict(text, strict_buffer.data());
+                ASSERT_EQ(strict_end, strict_buffer.data() + strict_buffer.size());
+                ASSERT_EQ(strict_result, expected_result);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, decode_utf16_matches_scalar_path) {
+    std::mt19937 engine{ 19U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 400U; size += 3U) {
+            const auto               text = random_text(engine, size, ratio);
+            const std::list<char8_t> list{ text.begin(), text.end() };
+
+            std::u16string expected_all = u"prefix";
+            utf8::ranges::decode_utf16(list, std::back_inserter(expected_all));
+
+            std::u16string expected_strict = u"prefix";
+            const auto [expected_out, expected_result] =
+                utf8::ranges::decode_utf16_strict(list, std::back_inserter(expected_strict));
+
+            const auto expected_length = utf8::ranges::utf16_length_from_utf8(list);
+            if(expected_result) {
+                ASSERT_EQ(expected_length, expected_strict.size() - 6U);
+            }
+
+            ASSERT_TRUE(std::ranges::equal(utf8::views::decode_utf16(list), expected_all.substr(6U)));
+
+            for_each_isa([&] {
+                ASSERT_EQ(utf8::ranges::utf16_length_from_utf8(text), expected_length);
+
+                std::u16string all = u"prefix";
+                utf8::ranges::decode_utf16(text, std::back_inserter(all));
+                ASSERT_EQ(all, expected_all);
+
+                // Exactly as large as the output, so that any write past it is caught by sanitizers.
+                std::vector<char16_t> buffer(expected_all.size() - 6U);
+                const auto            end = utf8::ranges::decode_utf16(text, buffer.data());
+                ASSERT_EQ(end, buffer.data() + buffer.size());
+                ASSERT_TRUE(std::ranges::equal(buffer, std::u16string_view{ expected_all }.substr(6U)));
+
+                std::u16string strict = u"prefix";
+                const auto [out, result] = utf8::ranges::decode_utf16_strict(text, std::back_inserter(strict));
+                ASSERT_EQ(strict, expected_strict);
+                ASSERT_EQ(result, expected_result);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, encode_utf16_matches_scalar_path) {
+    std::mt19937 engine{ 23U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 200U; ++size) {
+            const auto                text = random_utf16(engine, size, ratio);
+            const std::list<char16_t> list{ text.begin(), text.end() };
+
+            std::u8string expected_all = u8"prefix";
+            utf8::ranges::encode_utf16(list, std::back_inserter(expected_all));
+
+            std::u8string expected_strict = u8"prefix";
+            const auto [expected_out, expected_result] =
+                utf8::ranges::encode_utf16_strict(list, std::back_inserter(expected_strict));
+
+            ASSERT_TRUE(std::ranges::equal(utf8::views::encode_utf16(list), expected_all.substr(6U)));
+
+            for_each_isa([&] {
+                std::u8string all = u8"prefix";
+                utf8::ranges::encode_utf16(text, std::back_inserter(all));
+                ASSERT_EQ(all, expected_all);
+
+                // Exactly as large as the output, so that any write past it is caught by sanitizers.
+                std::vector<char8_t> buffer(expected_all.size() - 6U);
+                const auto           end = utf8::ranges::encode_utf16(text, buffer.data());
+                ASSERT_EQ(end, buffer.data() + buffer.size());
+                ASSERT_TRUE(std::ranges::equal(buffer, std::u8string_view{ expected_all }.substr(6U)));
+
+                std::u8string strict = u8"prefix";
+                const auto [out, result] = utf8::ranges::encode_utf16_strict(text, std::back_inserter(strict));
+                ASSERT_EQ(strict, expected_strict);
+                ASSERT_EQ(result, expected_result);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, utf16_round_trip) {
+    const std::u8string text = u8"a\u00E9\u20AC\U0001F600z";
+
+    std::u16string utf16;
+    utf8::ranges::decode_utf16(text, std::back_inserter(utf16));
+    ASSERT_EQ(utf16, u"a\u00E9\u20AC\U0001F600z");
+    ASSERT_EQ(utf8::ranges::utf16_length_from_utf8(text), utf16.size());
+
+    std::u8string utf8;
+    utf8::ranges::encode_utf16(utf16, std::back_inserter(utf8));
+    ASSERT_EQ(utf8, text);
+
+    const std::u16string unpaired = u"a\xD83D" u"b";
+
+    std::u8string repaired;
+    utf8::ranges::encode_utf16(unpaired, std::back_inserter(repaired));
+    ASSERT_EQ(repaired, u8"a\uFFFDb");
+
+    std::u8string strict;
+    const auto [out, result] = utf8::ranges::encode_utf16_strict(unpaired, std::back_inserter(strict));
+    ASSERT_EQ(strict, u8"a");
+    ASSERT_FALSE(result);
+    ASSERT_EQ(result.error(), utf8::Error::InvalidCodepoint);
+}
+
+TEST(Utf8AlgorithmTests, validate_reports_position) {
+    std::mt19937 engine{ 29U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 400U; size += 3U) {
+            const auto               text = random_text(engine, size, ratio);
+            const std::list<char8_t> list{ text.begin(), text.end() };
+
+            const auto expected = utf8::ranges::validate(list);
+            ASSERT_EQ(expected.valid, static_cast<std::size_t>(std::ranges::distance(list.begin(), expected.in)));
+            ASSERT_EQ(expected.result.has_value(), reference_is_valid(text));
+
+            std::u32string expected_out;
+            const auto     expected_decode = utf8::ranges::decode_checked(list, std::back_inserter(expected_out));
+            ASSERT_EQ(expected_decode.valid, expected.valid);
+            ASSERT_EQ(expected_decode.result, expected.result);
+
+            for_each_isa([&] {
+                const auto result = utf8::ranges::validate(text);
+                ASSERT_EQ(result.in, text.begin() + static_cast<std::ptrdiff_t>(expected.valid));
+                ASSERT_EQ(result.valid, expected.valid);
+                ASSERT_EQ(result.result, expected.result);
+
+                std::u32string out;
+                const auto     decode = utf8::ranges::decode_checked(text, std::back_inserter(out));
+                ASSERT_EQ(decode.in, result.in);
+                ASSERT_EQ(decode.valid, expected.valid);
+                ASSERT_EQ(decode.result, expected.result);
+                ASSERT_EQ(out, expected_out);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, validate_error_at_every_offset) {
+    for(std::size_t padding = 0U; padding < 140U; ++padding) {
+        for(const std::u8string_view error : { u8"\xFF", u8"\xC3", u8"\xE2\x82", u8"\xED\xA0\x80", u8"\xC0\xAF" }) {
+            std::u8string text(padding, u8'a');
+            text.append(error);
+            text.append(u8"é tail");
+
+            for_each_isa([&] {
+                const auto result = utf8::ranges::validate(text);
+                ASSERT_EQ(result.valid, padding);
+                ASSERT_FALSE(result.result);
+                ASSERT_EQ(result.result.error(), utf8::decode(error.begin(), error.end()).second.error());
+
+                const auto length = utf8::ranges::length(text);
+                ASSERT_FALSE(length);
+                ASSERT_EQ(length.error(), result.result.error());
+
+                const auto truncated = utf8::ranges::validate(std::u8string_view{ text }.substr(0U, padding + 1U));
+                ASSERT_EQ(truncated.valid, padding);
+                ASSERT_FALSE(truncated.result);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, encode_checked_reports_position) {
+    std::mt19937 engine{ 31U };
+
+    for(const double ratio : { 0.0, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 200U; ++size) {
+            const auto                text = random_codepoints(engine, size, ratio);
+            const std::list<char32_t> list{ text.begin(), text.end() };
+
+            std::u8string expected_out;
+            const auto    expected = utf8::ranges::encode_checked(list, std::back_inserter(expected_out));
+            ASSERT_EQ(expected.valid, static_cast<std::size_t>(std::ranges::distance(list.begin(), expected.in)));
+
+            for_each_isa([&] {
+                std::u8string out;
+                const auto    result = utf8::ranges::encode_checked(text, std::back_inserter(out));
+                ASSERT_EQ(result.in, text.begin() + static_cast<std::ptrdiff_t>(expected.valid));
+                ASSERT_EQ(result.valid, expected.valid);
+                ASSERT_EQ(result.result, expected.result);
+                ASSERT_EQ(out, expected_out);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, repair_if_needed_matches_repair) {
+    std::mt19937 engine{ 37U };
+
+    for(const double ratio : { 0.0, 0.001, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 300U; size += 3U) {
+            const auto text = random_text(engine, size, ratio);
+
+            std::u8string expected;
+            utf8::ranges::repair(text, std::back_inserter(expected));
+
+            for_each_isa([&] {
+                const auto repaired = utf8::ranges::repair_if_needed(text);
+                ASSERT_EQ(repaired.view(), expected);
+                ASSERT_EQ(repaired.is_copy(), !reference_is_valid(text));
+
+                if(!repaired.is_copy()) {
+                    ASSERT_EQ(repaired.data(), text.data());
+                }
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, exact_lengths_and_owning_conversions) {
+    std::mt19937 engine{ 41U };
+
+    for(const double ratio : { 0.0, 0.01, 0.1 }) {
+        for(std::size_t size = 0U; size < 300U; size += 3U) {
+            const auto                text   = random_text(engine, size, ratio);
+            const auto                points = random_codepoints(engine, size, ratio);
+            const std::list<char8_t>  list{ text.begin(), text.end() };
+            const std::list<char32_t> points_list{ points.begin(), points.end() };
+
+            std::u32string decoded;
+            utf8::ranges::decode_all(list, std::back_inserter(decoded));
+
+            std::u8string encoded;
+            utf8::ranges::encode_all(points_list, std::back_inserter(encoded));
+
+            std::u8string repaired;
+            utf8::ranges::repair(list, std::back_inserter(repaired));
+
+            ASSERT_EQ(utf8::ranges::utf32_length_from_utf8(list), decoded.size());
+            ASSERT_EQ(utf8::ranges::utf8_length_from_utf32(points_list), encoded.size());
+            ASSERT_EQ(utf8::ranges::utf8_length_after_repair(list), repaired.size());
+
+            ASSERT_EQ(utf8::ranges::to_u32string(list), decoded);
+            ASSERT_EQ(utf8::ranges::to_u8string(points_list), encoded);
+            ASSERT_EQ(utf8::ranges::repaired(list), repaired);
+
+            for_each_isa([&] {
+                ASSERT_EQ(utf8::ranges::utf32_length_from_utf8(text), decoded.size());
+                ASSERT_EQ(utf8::ranges::utf8_length_from_utf32(points), encoded.size());
+                ASSERT_EQ(utf8::ranges::utf8_length_after_repair(text), repaired.size());
+
+                ASSERT_EQ(utf8::ranges::to_u32string(text), decoded);
+                ASSERT_EQ(utf8::ranges::to_u8string(points), encoded);
+                ASSERT_EQ(utf8::ranges::repaired(text), repaired);
+            });
+        }
+    }
+}
+
+TEST(Utf8AlgorithmTests, validated_and_unchecked) {
+    EXPECT_EQ(utf8::ranges::validated(std::u8string_view{ u8"ab\xC0\xAF" }).error(), utf8::Error::OverlongEncoding);
+    EXPECT_EQ(utf8::ranges::validated(std::u8string_view{ u8"\xED\xA0\x80" }).error(), utf8::Error::InvalidCodepoint);
+    EXPECT_TRUE(utf8::ranges::validated(std::u8string_view{}).value().empty());
+
+    std::mt19937 engine{ 43U };
+
+    for(std::size_t size = 0U; size < 600U; size += 7U) {
+        const auto text  = random_text(engine, size, 0.0);
+        const auto valid = utf8::ranges::validated(text);
+        ASSERT_TRUE(valid);
+        ASSERT_EQ(valid->view(), text);
+
+        std::u32string expected;
+        utf8::ranges::decode_all(text, std::back_inserter(expected));
+
+        const std::list<char8_t> list{ text.begin(), text.end() };
+
+        std::u32string scalar;
+        utf8::ranges::decode_unchecked(list, std::back_inserter(scalar));
+        ASSERT_EQ(scalar, expected);
+
+        for_each_isa([&] {
+            std::u32string decoded;
+            utf8::ranges::decode_unchecked(*valid, std::back_inserter(decoded));
+
+            ASSERT_EQ(decoded, expected);
+            ASSERT_EQ(utf8::ranges::length_unchecked(*valid), expected.size());
+        });
+    }
+}
+
+TEST(Utf8AlgorithmTests, truncate_bytes_keeps_sequences_whole) {
+    std::mt19937 engine{ 47U };
+
+    const auto text = random_text(engine, 300U, 0.0);
+
+    for(std::size_t count = 0U; count <= text.size() + 2U; ++count) {
+        const auto prefix = utf8::ranges::truncate_bytes(std::u8string_view{ text }, count);
+
+        const std::u8string_view view{ prefix.begin(), prefix.end() };
+        ASSERT_EQ(view.data(), text.data());
+        ASSERT_LE(view.size(), count);
+        ASSERT_GE(view.size() + 3U, std::min(count, text.size()));
+        ASSERT_TRUE(utf8::ranges::is_valid(view)) << "count " << count;
+
+        // Nothing longer would do.
+        if(view.size() < std::min(count, text.size())) {
+            ASSERT_FALSE(utf8::ranges::is_valid(text.substr(0U, view.size() + 1U)));
+        }
+    }
+
+    const std::u8string_view broken = u8"a\x80\x80\x80\x80\x80";
+    EXPECT_EQ(std::ranges::size(utf8::ranges::truncate_bytes(broken, 5U)), 5U);
+    EXPECT_EQ(std::ranges::size(utf8::ranges::truncate_bytes(std::u8string_view{ u8"€" }, 2U)), 0U);
+}
+
+TEST(Utf8AlgorithmTests, take_and_drop_codepoints) {
+    static_assert(std::ranges::size(utf8::ranges::take_codepoints(std::u8string_view{ u8"aé€" }, 2U)) == 3U);
+    static_assert(std::ranges::size(utf8::ranges::drop_codepoints(std::u8string_view{ u8"aé€" }, 2U)) == 3U);
+
+    std::mt19937 engine{ 53U };
+
+    for(const std::size_t size : { 0U, 10U, 100U, 1000U }) {
+        const auto               text  = random_text(engine, size, 0.0);
+        const std::u8string_view view{ text };
+        const std::size_t        total = utf8::ranges::length_unchecked(view);
+
+        for_each_isa([&] {
+            for(std::size_t count = 0U; count <= total + 1U; count += count < 80U ? 1U : 37U) {
+                const auto taken   = utf8::ranges::take_codepoints(view, count);
+                const auto dropped = utf8::ranges::drop_codepoints(view, count);
+
+                ASSERT_EQ(taken.begin(), view.begin());
+                ASSERT_EQ(taken.end(), dropped.begin());
+                ASSERT_EQ(dropped.end(), view.end());
+
+                ASSERT_EQ(utf8::ranges::length_unchecked(taken), std::min(count, total));
+                ASSERT_TRUE(utf8::ranges::is_valid(taken)) << "count " << count;
+                ASSERT_TRUE(utf8::ranges::is_valid(dropped)) << "count " << count;
+            }
+        });
+    }
+}
+
+namespace {
+    // Offset and size of the first sequence of `input` that decodes to a codepoint of `set`.
+    auto reference_find(const std::u8string_view input, const std::u32string_view set) -> std::pair<std::size_t, std::size_t> {
+        for(auto it = input.begin(); it != input.end();) {
+            const auto [next, codepoint] = utf8::decode(it, input.end());
+            if(codepoint && set.contains(*codepoint)) {
+                return { static_cast<std::size_t>(it - input.begin()), static_cast<std::size_t>(next - it) };
+            }
+
+            it = next;
+        }
+
+        return { input.size(), 0U };
+    }
+}
+
+TEST(Utf8AlgorithmTests, find_codepoints) {
+    static_assert(utf8::ranges::find(std::u8string_view{ u8"a\u00E9b" }, U'b').begin() - u8"a\u00E9b" == 3);
+    static_assert(utf8::ranges::find_any_of(std::u8string_view{ u8"a\u00E9b" }, U"b\u00E9").size() == 2U);
+
+    static constexpr std::array<std::u32string_view, 7U> sets = {
+        U"a", U"\u2028", U"\U0010FFFF", U"\u3001\u3002", U"~\uE000", U"\u00E9\u0800\U00010000", U"\uD7FF\u00E9\uFFFF",
+    };
+
+    std::mt19937 engine{ 59U };
+
+    for(const double invalid_ratio : { 0.0, 0.05 }) {
+        for(const std::size_t size : { 0U, 1U, 7U, 100U, 1000U }) {
+            auto text = random_text(engine, size, invalid_ratio);
+            text += u8"\u2028\u3002";
+
+            const std::u8string_view view{ text };
+
+            for(const auto set : sets) {
+                const auto [offset, length] = reference_find(view, set);
+
+                const auto found = utf8::ranges::find_any_of(view, set);
+                ASSERT_EQ(found.begin() - view.begin(), static_cast<std::ptrdiff_t>(offset));
+                ASSERT_EQ(found.size(), length);
+
+                for(const char32_t codepoint : set) {
+                    const char32_t single[] = { codepoint };
+                    const auto [expected, units] = reference_find(view, { single, 1U });
+
+                    const auto match = utf8::ranges::find(view, codepoint);
+                    ASSERT_EQ(match.begin() - view.begin(), static_cast<std::ptrdiff_t>(expected));
+                    ASSERT_EQ(match.size(), units);
+                }
+            }
+        }
+    }
+
+    const std::u8string_view text = u8"a\u00E9";
+    EXPECT_TRUE(utf8::ranges::find(text, char32_t{ 0xD800U }).empty());
+    EXPECT_EQ(utf8::ranges::find(text, char32_t{ 0xD800U }).begin(), text.end());
+    EXPECT_EQ(utf8::ranges::find_any_of(text, U"").begin(), text.end());
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <utf8/algorithm.hpp>
+#include <utf8/batch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    // Fields of 0 to `max_size` units, some of them broken, including at their ends.
+    auto random_fields(std::mt19937& engine, const std::size_t count, const std::size_t max_size) -> std::vector<std::u8string> {
+        static constexpr std::array<std::u8string_view, 10U> pieces = {
+            u8"a", u8"~", u8"\u00E9", u8"\u0800", u8"\uFFFD", u8"\U0010FFFF",
+            u8"\xFF", u8"\xE2\x82", u8"\x80", u8"\xED\xA0\x80",
+        };
+
+        std::uniform_int_distribution<std::size_t> size{ 0U, max_size };
+        std::uniform_int_distribution<std::size_t> pick{ 0U, pieces.size() - 1U };
+        std::bernoulli_distribution                broken{ 0.2 };
+
+        std::vector<std::u8string> result;
+        for(std::size_t i = 0U; i < count; ++i) {
+            const bool        is_broken = broken(engine);
+            const std::size_t target    = size(engine);
+
+            std::u8string field;
+            while(field.size() < target) {
+                field += pieces[is_broken ? pick(engine) : pick(engine) % 6U];
+            }
+
+            result.push_back(std::move(field));
+        }
+
+        return result;
+    }
+
+    auto bit(const std::vector<std::uint8_t>& bitmap, const std::size_t i) -> bool {
+        return (bitmap[i / 8U] >> (i % 8U) & 1U) != 0U;
+    }
+
+    // Checks every layout against one call of `is_valid` per field.
+    auto check(const std::vector<std::u8string>& fields) -> void {
+        std::u8string             blob;
+        std::vector<std::int32_t> offsets32{ 0 };
+        std::vector<std::int64_t> offsets64{ 0 };
+        for(const auto& field : fields) {
+            blob += field;
+            offsets32.push_back(static_cast<std::int32_t>(blob.size()));
+            offsets64.push_back(static_cast<std::int64_t>(blob.size()));
+        }
+
+        std::vector<std::span<const char8_t>> spans{ fields.begin(), fields.end() };
+
+        std::size_t expected_invalid = 0U;
+        std::size_t expected_first   = fields.size();
+        for(std::size_t i = 0U; i < fields.size(); ++i) {
+            if(!utf8::ranges::is_valid(fields[i])) {
+                ++expected_invalid;
+                expected_first = std::min(expected_first, i);
+            }
+        }
+
+        std::vector<std::uint8_t> bitmap32((fields.size() + 7U) / 8U, 0xFFU);
+        std::vector<std::uint8_t> bitmap64(bitmap32.size(), 0xFFU);
+        std::vector<std::uint8_t> bitmap_spans(bitmap32.size(), 0xFFU);
+
+        ASSERT_EQ(utf8::batch::validate(blob, offsets32, bitmap32), expected_invalid);
+        ASSERT_EQ(utf8::batch::validate(blob, offsets64, bitmap64), expected_invalid);
+        ASSERT_EQ(utf8::batch::validate(spans, bitmap_spans), expected_invalid);
+
+        for(std::size_t i = 0U; i < fields.size(); ++i) {
+            const bool valid = utf8::ranges::is_valid(fields[i]);
+
+            ASSERT_EQ(bit(bitmap32, i), valid) << "field " << i;
+            ASSERT_EQ(bit(bitmap64, i), valid) << "field " << i;
+            ASSERT_EQ(bit(bitmap_spans, i), valid) << "field " << i;
+        }
+
+        ASSERT_EQ(utf8::batch::first_invalid(blob, offsets32), expected_first);
+        ASSERT_EQ(utf8::batch::first_invalid(blob, offsets64), expected_first);
+        ASSERT_EQ(utf8::batch::first_invalid(spans), expected_first);
+    }
+}
+
+TEST(Utf8BatchTests, matches_per_field_validation) {
+    std::mt19937 engine{ 11U };
+
+    for(const std::size_t max_size : { 0U, 3U, 20U, 200U }) {
+        for(const std::size_t count : { 0U, 1U, 7U, 64U, 1000U }) {
+            check(random_fields(engine, count, max_size));
+        }
+    }
+}
+
+TEST(Utf8BatchTests, sequences_split_between_fields) {
+    // Each field is invalid, although the fields together are valid text.
+    check({ u8"a\xE2", u8"\x82\xAC", u8"b" });
+    check({ u8"\xF0\x9F", u8"\x98", u8"\x80" });
+    check({ u8"", u8"\xC3", u8"", u8"\xA9", u8"" });
+}
+
+TEST(Utf8BatchTests, long_fields) {
+    std::u8string valid;
+    while(valid.size() < 40000U) {
+        valid += u8"a€\U0001F600é";
+    }
+
+    auto broken = valid;
+    broken[30000U] = u8'\xFF';
+
+    check({ u8"x", valid, u8"y", broken, valid, u8"\xFF" });
+}
+
+TEST(Utf8BatchTests, sliced_offsets) {
+    const std::u8string_view           blob    = u8"\xFF" u8"abé\xE2" u8"c";
+    const std::array<std::int32_t, 4U> offsets = { 1, 3, 5, 6 };
+
+    std::array<std::uint8_t, 1U> bitmap{};
+    EXPECT_EQ(utf8::batch::validate(blob, offsets, bitmap), 1U);
+    EXPECT_EQ(bitmap[0U], 0b011U);
+    EXPECT_EQ(utf8::batch::first_invalid(blob, offsets), 2U);
+}
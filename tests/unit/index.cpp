@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <utf8/index.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    auto mixed_text() -> std::u8string {
+        static constexpr std::array<std::u8string_view, 4U> pieces = { u8"a", u8"é", u8"€", u8"\U0001F600" };
+
+        std::u8string result;
+        for(std::size_t i = 0U; result.size() < 5000U; ++i) {
+            result += pieces[i % pieces.size()];
+            result += u8"aé\n€\U0001F600";
+        }
+
+        return result;
+    }
+
+    // Byte offset of every codepoint, and the size at the end.
+    auto starts(const std::u8string_view text) -> std::vector<std::size_t> {
+        std::vector<std::size_t> result;
+        for(std::size_t i = 0U; i < text.size(); ++i) {
+            if((text[i] & 0xC0U) != 0x80U) {
+                result.push_back(i);
+            }
+        }
+
+        result.push_back(text.size());
+
+        return result;
+    }
+}
+
+TEST(Utf8IndexTests, byte_and_codepoint_offsets) {
+    const auto text     = mixed_text();
+    const auto expected = starts(text);
+
+    for(const std::size_t interval : { 1U, 3U, 64U, 256U, 1000U }) {
+        const utf8::OffsetIndex index{ text, interval };
+
+        ASSERT_EQ(index.size(), expected.size() - 1U);
+        ASSERT_EQ(index.size_bytes(), text.size());
+
+        for(std::size_t i = 0U; i < expected.size(); ++i) {
+            ASSERT_EQ(index.byte_offset(text, i), expected[i]) << "interval " << interval << ", codepoint " << i;
+        }
+
+        std::size_t codepoint = 0U;
+        for(std::size_t byte = 0U; byte <= text.size(); ++byte) {
+            ASSERT_EQ(index.codepoint_offset(text, byte), codepoint) << "interval " << interval << ", byte " << byte;
+
+            if(byte < text.size() && (text[byte] & 0xC0U) != 0x80U) {
+                ++codepoint;
+            }
+        }
+    }
+}
+
+TEST(Utf8IndexTests, append_matches_build) {
+    const auto text = mixed_text();
+
+    const utf8::OffsetIndex built{ text, 100U, true };
+
+    // Appends in uneven pieces, some of them splitting sequences.
+    utf8::OffsetIndex appended{ 100U, true };
+    for(std::size_t first = 0U, step = 1U; first < text.size(); first += step, step = step * 2U % 997U + 1U) {
+        appended.append(std::span<const char8_t>{ text }.subspan(first, std::min(step, text.size() - first)));
+    }
+
+    ASSERT_EQ(appended.size(), built.size());
+    ASSERT_EQ(appended.line_count(), built.line_count());
+
+    for(std::size_t i = 0U; i <= built.size(); i += 7U) {
+        EXPECT_EQ(appended.byte_offset(text, i), built.byte_offset(text, i));
+    }
+
+    for(std::size_t line = 0U; line < built.line_count(); ++line) {
+        EXPECT_EQ(appended.line_start(line), built.line_start(line));
+    }
+}
+
+TEST(Utf8IndexTests, lines) {
+    const std::u8string_view text = u8"ab\né\n\nc";
+
+    const utf8::OffsetIndex index{ text, 2U, true };
+
+    ASSERT_EQ(index.line_count(), 4U);
+    EXPECT_EQ(index.line_start(0U), 0U);
+    EXPECT_EQ(index.line_start(1U), 3U);
+    EXPECT_EQ(index.line_start(2U), 6U);
+    EXPECT_EQ(index.line_start(3U), 7U);
+
+    EXPECT_EQ(index.line_of(0U), 0U);
+    EXPECT_EQ(index.line_of(2U), 0U);
+    EXPECT_EQ(index.line_of(3U), 1U);
+    EXPECT_EQ(index.line_of(6U), 2U);
+    EXPECT_EQ(index.line_of(8U), 3U);
+
+    EXPECT_EQ(utf8::OffsetIndex(text).line_count(), 1U);
+}
+
+TEST(Utf8IndexTests, empty) {
+    const utf8::OffsetIndex index{};
+
+    EXPECT_EQ(index.size(), 0U);
+    EXPECT_EQ(index.byte_offset({}, 0U), 0U);
+    EXPECT_EQ(index.codepoint_offset({}, 0U), 0U);
+    EXPECT_EQ(index.line_count(), 1U);
+}
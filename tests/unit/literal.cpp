@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <utf8/literal.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <string_view>
+
+namespace {
+    template<utf8::FixedString S>
+    constexpr bool is_literal = requires { typename utf8::Literal<S>; };
+}
+
+static_assert(is_literal<u8"">);
+static_assert(is_literal<u8"héllo \U0001F600">);
+static_assert(is_literal<"plain">);
+static_assert(!is_literal<u8"\xFF">);
+static_assert(!is_literal<u8"\xC0\xAF">);
+static_assert(!is_literal<u8"\xED\xA0\x80">);
+static_assert(!is_literal<u8"abc\xE2\x82">);
+
+static_assert(utf8::literal<u8"héllo \U0001F600">.size() == 11U);
+static_assert(utf8::literal<u8"héllo \U0001F600">.length() == 7U);
+static_assert(utf8::literal<u8"">.length() == 0U);
+
+TEST(Utf8LiteralTests, units_and_codepoints) {
+    constexpr auto text = utf8::literal<u8"aé€\U0001F600">;
+
+    constexpr std::u8string_view view = text;
+    EXPECT_EQ(view, u8"aé€\U0001F600");
+    EXPECT_EQ(text.view().data(), text.data());
+    EXPECT_TRUE(std::ranges::equal(text, view));
+
+    constexpr auto codepoints = text.codepoints();
+    static_assert(codepoints.size() == 4U);
+    static_assert(codepoints[3] == U'\U0001F600');
+
+    constexpr std::array<char32_t, 4U> expected = { U'a', U'é', U'€', U'\U0001F600' };
+    EXPECT_TRUE(std::ranges::equal(codepoints, expected));
+}
+
+TEST(Utf8LiteralTests, user_defined_literal) {
+    using namespace utf8::literals;
+
+    constexpr auto text = u8"été"_utf8;
+
+    static_assert(std::same_as<decltype(text), const utf8::Literal<u8"été">>);
+    static_assert(text.length() == 3U);
+
+    EXPECT_EQ(text.view(), u8"été");
+}
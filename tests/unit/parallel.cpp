@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <utf8/algorithm.hpp>
+#include <utf8/parallel.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace {
+    // Mixed-length text large enough to be split between 8 threads.
+    auto large_text() -> std::u8string {
+        std::u8string result;
+        while(result.size() < 600U << 10U) {
+            result += u8"a€\U0001F600é";
+        }
+
+        return result;
+    }
+}
+
+TEST(Utf8ParallelTests, is_valid_valid_input) {
+    const auto text = large_text();
+
+    for(std::size_t threads = 0U; threads <= 8U; ++threads) {
+        EXPECT_TRUE(utf8::parallel::is_valid(text, threads));
+    }
+
+    EXPECT_TRUE(utf8::parallel::is_valid(std::span<const char8_t>{}, 4U));
+}
+
+TEST(Utf8ParallelTests, is_valid_errors_near_split_points) {
+    const auto text = large_text();
+
+    for(const std::u8string_view error : { u8"\x80", u8"\xE2", u8"\xF0\x9F", u8"\xFF", u8"\x80\x80\x80\x80" }) {
+        for(std::size_t threads = 2U; threads <= 8U; ++threads) {
+            for(std::size_t i = 1U; i < threads; ++i) {
+                for(std::size_t offset = 0U; offset < 8U; ++offset) {
+                    auto broken = text;
+                    broken.replace(text.size() / threads * i + offset - 4U, error.size(), error);
+
+                    ASSERT_EQ(utf8::parallel::is_valid(broken, threads), utf8::ranges::is_valid(broken))
+                        << threads << " threads, split " << i << ", offset " << offset;
+                }
+            }
+        }
+    }
+}
+
+TEST(Utf8ParallelTests, is_valid_error_at_end) {
+    auto text = large_text();
+    text += u8"\xE2\x82";
+
+    EXPECT_FALSE(utf8::parallel::is_valid(text, 4U));
+}
+
+TEST(Utf8ParallelTests, decode_all_matches_sequential) {
+    const auto text = large_text();
+
+    std::u32string expected;
+    utf8::ranges::decode_all(text, std::back_inserter(expected));
+
+    for(std::size_t threads = 0U; threads <= 8U; ++threads) {
+        EXPECT_EQ(utf8::parallel::decode_all(text, threads), expected);
+    }
+
+    EXPECT_TRUE(utf8::parallel::decode_all(std::span<const char8_t>{}, 4U).empty());
+}
+
+TEST(Utf8ParallelTests, decode_all_replaces_errors_near_split_points) {
+    const auto text = large_text();
+
+    for(const std::u8string_view error : { u8"\x80", u8"\xE2", u8"\xF0\x9F", u8"\xFF", u8"\x80\x80\x80\x80" }) {
+        for(std::size_t threads = 2U; threads <= 8U; ++threads) {
+            for(std::size_t i = 1U; i < threads; ++i) {
+                for(std::size_t offset = 0U; offset < 8U; ++offset) {
+                    auto broken = text;
+                    broken.replace(text.size() / threads * i + offset - 4U, error.size(), error);
+
+                    std::u32string expected;
+                    utf8::ranges::decode_all(broken, std::back_inserter(expected));
+
+                    ASSERT_EQ(utf8::parallel::decode_all(broken, threads), expected)
+                        << threads << " threads, split " << i << ", offset " << offset;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+
+#include <utf8/ranges.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    auto random_units(std::mt19937& engine, const std::size_t size) -> std::u8string {
+        static constexpr std::array<std::u8string_view, 9U> pieces = {
+            u8"a", u8"~", u8"\u00E9", u8"\u0800", u8"\uFFFD", u8"\U0010FFFF", u8"\xFF", u8"\xF0\x90", u8"\x80",
+        };
+
+        std::uniform_int_distribution<std::size_t> pick{ 0U, pieces.size() - 1U };
+
+        std::u8string result;
+        while(result.size() < size) {
+            result += pieces[pick(engine)];
+        }
+
+        return result;
+    }
+
+    // Decodes through the one-at-a-time iterator, which non-contiguous input uses.
+    auto decode_scalar(const std::u8string_view input) -> std::vector<char32_t> {
+        const std::list<char8_t> units{ input.begin(), input.end() };
+
+        std::vector<char32_t> result;
+        std::ranges::copy(units | utf8::views::decode, std::back_inserter(result));
+
+        return result;
+    }
+
+    auto decode_blocks(const std::u8string_view input) -> std::vector<char32_t> {
+        std::vector<char32_t> result;
+        std::ranges::copy(input | utf8::views::decode, std::back_inserter(result));
+
+        return result;
+    }
+}
+
+TEST(Utf8RangesTests, decode_blocks_match_iterator) {
+    std::mt19937 engine{ 7U };
+
+    for(std::size_t size = 0U; size < 300U; ++size) {
+        const auto input = random_units(engine, size);
+
+        EXPECT_EQ(decode_blocks(input), decode_scalar(input)) << "size " << size;
+    }
+}
+
+static_assert(std::same_as<
+    std::ranges::iterator_t<utf8::ranges::DecodeView<utf8::ValidView>>,
+    utf8::BlockIterator<true>
+>);
+
+TEST(Utf8RangesTests, decode_valid_view_matches_checked) {
+    std::mt19937 engine{ 9U };
+
+    for(std::size_t size = 0U; size < 300U; ++size) {
+        auto input = random_units(engine, size);
+        std::erase_if(input, [](const char8_t unit) { return unit >= 0xF8U; });
+
+        const auto repaired = utf8::ranges::repaired(input);
+        const auto valid    = utf8::ranges::validated(repaired);
+        ASSERT_TRUE(valid);
+
+        std::vector<char32_t> decoded;
+        std::ranges::copy(*valid | utf8::views::decode, std::back_inserter(decoded));
+
+        EXPECT_EQ(decoded, decode_blocks(repaired)) << "size " << size;
+
+        std::vector<char32_t> reversed;
+        std::ranges::copy(*valid | utf8::views::decode | std::views::reverse, std::back_inserter(reversed));
+        std::ranges::reverse(reversed);
+
+        EXPECT_EQ(reversed, decoded) << "size " << size;
+    }
+}
+
+TEST(Utf8RangesTests, decode_blocks_leading_continuation) {
+    EXPECT_EQ(decode_blocks(u8"\x80\x80" u8"a"), (std::vector<char32_t>{ U'\uFFFD', U'\uFFFD', U'a' }));
+}
+
+TEST(Utf8RangesTests, decode_blocks_skip_bom) {
+    EXPECT_EQ(decode_blocks(u8"\uFEFFab"), (std::vector<char32_t>{ U'a', U'b' }));
+    EXPECT_EQ(decode_blocks(u8"\uFEFF"), std::vector<char32_t>{});
+    EXPECT_EQ(decode_blocks(u8"a\uFEFF"), (std::vector<char32_t>{ U'a', U'\uFEFF' }));
+}
+
+TEST(Utf8RangesTests, decode_blocks_forward) {
+    std::mt19937 engine{ 11U };
+
+    const auto input = random_units(engine, 1000U);
+    const auto view  = std::u8string_view{ input } | utf8::views::decode;
+
+    static_assert(std::ranges::forward_range<decltype(view)>);
+
+    auto first  = view.begin();
+    auto second = view.begin();
+    EXPECT_EQ(first, second);
+
+    const auto length = std::ranges::distance(view);
+    for(std::ptrdiff_t i = 0; i < length; ++i) {
+        ASSERT_EQ(*first++, *second);
+        ASSERT_NE(first, second);
+
+        ++second;
+        ASSERT_EQ(first, second);
+    }
+
+    EXPECT_EQ(first, std::default_sentinel);
+}
+
+TEST(Utf8RangesTests, decode_reverse) {
+    std::mt19937 engine{ 13U };
+
+    for(std::size_t size = 0U; size < 300U; size += 7U) {
+        const auto input = random_units(engine, size);
+
+        auto expected = decode_scalar(input);
+        std::ranges::reverse(expected);
+
+        const std::list<char8_t> units{ input.begin(), input.end() };
+
+        const auto blocks = std::u8string_view{ input } | utf8::views::decode | std::views::reverse;
+        const auto scalar = units | utf8::views::decode | std::views::reverse;
+
+        static_assert(std::ranges::common_range<decltype(std::u8string_view{} | utf8::views::decode)>);
+        static_assert(std::ranges::bidirectional_range<decltype(units | utf8::views::decode)>);
+
+        EXPECT_EQ(std::vector<char32_t>(blocks.begin(), blocks.end()), expected) << "size " << size;
+        EXPECT_EQ(std::vector<char32_t>(scalar.begin(), scalar.end()), expected) << "size " << size;
+    }
+}
+
+TEST(Utf8RangesTests, decode_prev_stops_at_bom) {
+    const std::u8string_view input = u8"\uFEFFab";
+
+    const auto view = input | utf8::views::decode;
+
+    EXPECT_EQ(*std::ranges::prev(view.end()), U'b');
+    EXPECT_TRUE(std::ranges::prev(view.end(), 2) == view.begin());
+}
+
+TEST(Utf8RangesTests, decode_blocks_constexpr) {
+    static constexpr auto count = [] {
+        std::size_t result = 0U;
+        for(const char32_t codepoint : std::u8string_view{ u8"\uFEFFh\u00E9llo \xFF" } | utf8::views::decode) {
+            result += codepoint == U'\uFFFD' ? 100U : 1U;
+        }
+
+        return result;
+    }();
+
+    static_assert(count == 106U);
+}
+
+TEST(Utf8RangesTests, sanitize_segments_match_sanitize) {
+    std::mt19937 engine{ 17U };
+
+    for(std::size_t size = 0U; size < 300U; ++size) {
+        const auto               input = random_units(engine, size);
+        const std::list<char8_t> units{ input.begin(), input.end() };
+
+        std::u8string expected;
+        std::ranges::copy(units | utf8::views::sanitize, std::back_inserter(expected));
+
+        std::u8string sanitized;
+        std::ranges::copy(std::u8string_view{ input } | utf8::views::sanitize, std::back_inserter(sanitized));
+        EXPECT_EQ(sanitized, expected) << "size " << size;
+
+        std::u8string joined;
+        for(const auto segment : std::u8string_view{ input } | utf8::views::sanitize_segments) {
+            ASSERT_FALSE(segment.empty());
+
+            joined.append(segment.begin(), segment.end());
+        }
+
+        EXPECT_EQ(joined, expected) << "size " << size;
+    }
+}
+
+TEST(Utf8RangesTests, sanitize_segments_valid_input) {
+    const std::u8string_view input = u8"\uFEFFh\u00E9llo \U0001F600";
+
+    const auto segments = input | utf8::views::sanitize_segments;
+
+    ASSERT_EQ(std::ranges::distance(segments), 1);
+    EXPECT_EQ((*segments.begin()).data(), input.data() + utf8::BOM_UNITS.size());
+    EXPECT_EQ((*segments.begin()).size(), input.size() - utf8::BOM_UNITS.size());
+
+    EXPECT_TRUE(std::ranges::empty(std::u8string_view{} | utf8::views::sanitize_segments));
+}
+
+TEST(Utf8RangesTests, sanitize_segments_errors) {
+    const std::u8string_view input = u8"ab\xFF\xE2\x82" u8"c";
+
+    std::vector<std::u8string_view> segments;
+    for(const auto segment : input | utf8::views::sanitize_segments) {
+        segments.emplace_back(segment.begin(), segment.end());
+    }
+
+    const std::vector<std::u8string_view> expected = { u8"ab", u8"\uFFFD", u8"\uFFFD", u8"c" };
+    EXPECT_EQ(segments, expected);
+}
+
+TEST(Utf8RangesTests, split_on_matches_split) {
+    std::mt19937 engine{ 61U };
+
+    for(const char32_t delimiter : { U'a', U'\u00E9', U'\U0010FFFF' }) {
+        const auto encoded = *utf8::encode(delimiter);
+
+        const std::u8string_view needle{ encoded.begin(), encoded.end() };
+
+        for(std::size_t size = 0U; size < 100U; ++size) {
+            const auto               input = random_units(engine, size);
+            const std::u8string_view view{ input };
+
+            std::vector<std::u8string_view> expected;
+            for(const auto piece : std::views::split(view, needle)) {
+                expected.emplace_back(piece.begin(), piece.end());
+            }
+
+            std::vector<std::u8string_view> pieces;
+            for(const auto piece : view | utf8::views::split_on(delimiter)) {
+                pieces.push_back(piece);
+            }
+
+            ASSERT_EQ(pieces, expected) << "size " << size;
+
+            for(std::size_t i = 0U; i < pieces.size(); ++i) {
+                ASSERT_EQ(pieces[i].data(), expected[i].data());
+            }
+        }
+    }
+}
+
+TEST(Utf8RangesTests, split_on_edges) {
+    const auto split = [](const std::u8string_view input, const char32_t delimiter) {
+        std::vector<std::u8string_view> pieces;
+        std::ranges::copy(utf8::views::split_on(input, delimiter), std::back_inserter(pieces));
+
+        return pieces;
+    };
+
+    using Pieces = std::vector<std::u8string_view>;
+
+    EXPECT_EQ(split(u8"", U','), Pieces{});
+    EXPECT_EQ(split(u8",", U','), (Pieces{ u8"", u8"" }));
+    EXPECT_EQ(split(u8"a\u2028\u2028b\u2028", U'\u2028'), (Pieces{ u8"a", u8"", u8"b", u8"" }));
+    EXPECT_EQ(split(u8"\u3001x", U'\u3001'), (Pieces{ u8"", u8"x" }));
+    EXPECT_EQ(split(u8"a,b", char32_t{ 0xD800U }), Pieces{ u8"a,b" });
+
+    static_assert(std::ranges::distance(std::u8string_view{ u8"a\u00E9b\u00E9" } | utf8::views::split_on(U'\u00E9')) == 3);
+    static_assert(std::ranges::forward_range<utf8::ranges::SplitOnView<std::u8string_view>>);
+}
@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+
+#include <utf8/simd.hpp>
+
+TEST(Utf8DispatchTests, best_isa_is_supported) {
+    EXPECT_TRUE(utf8::is_supported(utf8::best_isa()));
+    EXPECT_TRUE(utf8::is_supported(utf8::Isa::Fallback));
+}
+
+TEST(Utf8DispatchTests, force_isa) {
+    ASSERT_TRUE(utf8::force_isa(utf8::Isa::Fallback));
+    EXPECT_EQ(utf8::active_isa(), utf8::Isa::Fallback);
+
+    ASSERT_TRUE(utf8::force_isa(utf8::best_isa()));
+    EXPECT_EQ(utf8::active_isa(), utf8::best_isa());
+}
+
+TEST(Utf8DispatchTests, force_unsupported_isa) {
+    const auto active = utf8::active_isa();
+
+    for(const auto isa : { utf8::Isa::Sse42, utf8::Isa::Avx2, utf8::Isa::Avx512 }) {
+        if(!utf8::is_supported(isa)) {
+            EXPECT_FALSE(utf8::force_isa(isa));
+            EXPECT_EQ(utf8::active_isa(), active);
+        }
+    }
+}
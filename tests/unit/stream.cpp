@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <utf8/algorithm.hpp>
+#include <utf8/error.hpp>
+#include <utf8/stream.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    auto samples() -> std::vector<std::u8string> {
+        std::u8string long_text;
+        for(std::size_t i = 0U; i < 40U; ++i) {
+            long_text += u8"abé€\U0001F600";
+        }
+
+        std::vector<std::u8string> result = {
+            u8"",
+            u8"plain ascii",
+            u8"é߿ࠀ�\U00010000\U0010FFFF",
+            u8"a\xE2\x82",
+            u8"\xF0\x9F\x98",
+            u8"a\xE2\x82" u8"b",
+            u8"\xED\xA0\x80 surrogate",
+            u8"\xC0\xAF overlong",
+            u8"\xF4\x90\x80\x80 too large",
+            u8"\xFF lone",
+            u8"\x80 stray continuation",
+            long_text,
+            long_text + u8"\xE2\x82",
+            long_text + u8"\xF5\x80\x80\x80" + long_text,
+        };
+
+        return result;
+    }
+
+    // Feeds `text` in pieces of at most `step` units.
+    auto validate_in_steps(const std::u8string_view text, const std::size_t step) -> utf8::Expected<void> {
+        utf8::StreamValidator validator;
+
+        for(std::size_t offset = 0U; offset < text.size(); offset += step) {
+            const auto chunk = text.substr(offset, step);
+
+            (void)validator.feed(std::span{ chunk.data(), chunk.size() });
+        }
+
+        return validator.finish();
+    }
+}
+
+TEST(Utf8StreamTests, validator_matches_whole_buffer_at_every_split) {
+    for(const auto& text : samples()) {
+        const auto expected = utf8::ranges::validate(text).result;
+
+        for(std::size_t split = 0U; split <= text.size(); ++split) {
+            const std::u8string_view view{ text };
+
+            utf8::StreamValidator validator;
+            (void)validator.feed(std::span{ view.data(), split });
+            (void)validator.feed(std::span{ view.data() + split, view.size() - split });
+
+            ASSERT_EQ(validator.finish(), expected) << "split " << split;
+        }
+
+        ASSERT_EQ(validate_in_steps(text, 1U), expected);
+        ASSERT_EQ(validate_in_steps(text, 2U), expected);
+        ASSERT_EQ(validate_in_steps(text, 7U), expected);
+    }
+}
+
+TEST(Utf8StreamTests, decoder_matches_whole_buffer_at_every_split) {
+    for(const auto& text : samples()) {
+        std::u32string expected;
+        const auto [expected_out, expected_result] = utf8::ranges::decode_strict(text, std::back_inserter(expected));
+
+        for(std::size_t split = 0U; split <= text.size(); ++split) {
+            const std::u8string_view view{ text };
+
+            utf8::StreamDecoder decoder;
+            std::u32string      decoded;
+
+            (void)decoder.feed(std::span{ view.data(), split }, std::back_inserter(decoded));
+            (void)decoder.feed(std::span{ view.data() + split, view.size() - split }, std::back_inserter(decoded));
+
+            ASSERT_EQ(decoder.finish(), expected_result) << "split " << split;
+            ASSERT_EQ(decoded, expected) << "split " << split;
+        }
+    }
+}
+
+TEST(Utf8StreamTests, finish_reports_truncation) {
+    const std::u8string_view text = u8"a\xE2\x82";
+
+    utf8::StreamValidator validator;
+    ASSERT_TRUE(validator.feed(std::span{ text.data(), text.size() }));
+    ASSERT_EQ(validator.finish(), utf8::Expected<void>{ utf8::Unexpected{ utf8::Error::InvalidByteSequence } });
+
+    // Finishing starts a new stream.
+    const std::u8string_view next = u8"€";
+    ASSERT_TRUE(validator.feed(std::span{ next.data(), next.size() }));
+    ASSERT_TRUE(validator.finish());
+}
+
+TEST(Utf8StreamTests, errors_are_sticky) {
+    const std::u8string_view bad  = u8"\xFF";
+    const std::u8string_view good = u8"good";
+
+    utf8::StreamDecoder decoder;
+    std::u32string      decoded;
+
+    ASSERT_FALSE(decoder.feed(std::span{ bad.data(), bad.size() }, std::back_inserter(decoded)).second);
+    ASSERT_FALSE(decoder.feed(std::span{ good.data(), good.size() }, std::back_inserter(decoded)).second);
+    ASSERT_TRUE(decoded.empty());
+    ASSERT_FALSE(decoder.finish());
+}
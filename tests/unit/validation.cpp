@@ -4,8 +4,12 @@
 #include <utf8/validation.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 TEST(Utf8LeadingTests, decoded_length_success) {
     static constexpr auto test_case = [](const char8_t input, const std::uint8_t expected_length) noexcept -> void {
@@ -209,10 +213,58 @@ TEST(Utf8EncodingTests, decode_error) {
     // Overlong
     test_case(std::initializer_list<char8_t>{ 0xC0U, 0xAFU }, utf8::Error::OverlongEncoding, 2U);
     test_case(std::initializer_list<char8_t>{ 0xF0U, 0x82U, 0x82U, 0xACU }, utf8::Error::OverlongEncoding, 4U);
+    test_case(std::initializer_list<char8_t>{ 0xC1U, 0xBFU }, utf8::Error::OverlongEncoding, 2U);
+    test_case(std::initializer_list<char8_t>{ 0xE0U, 0x9FU, 0xBFU }, utf8::Error::OverlongEncoding, 3U);
+    test_case(std::initializer_list<char8_t>{ 0xE0U, 0x9FU, 0x00U }, utf8::Error::InvalidByteSequence, 2U);
 
     // Invalid codepoints
     test_case(std::initializer_list<char8_t>{ 0xEDU, 0xA0U, 0x80U }, utf8::Error::InvalidCodepoint, 3U);
     test_case(std::initializer_list<char8_t>{ 0xF4U, 0x90U, 0x80U, 0x80U }, utf8::Error::InvalidCodepoint, 4U);
+    test_case(std::initializer_list<char8_t>{ 0xF5U, 0x80U, 0x80U, 0x80U }, utf8::Error::InvalidCodepoint, 4U);
+}
+
+TEST(Utf8EncodingTests, decode_constexpr) {
+    static constexpr std::array<char8_t, 4U> units = { 0xF0U, 0x9FU, 0x98U, 0x80U };
+
+    static constexpr auto result = utf8::decode(units.begin(), units.end());
+
+    static_assert(result.first == units.end());
+    static_assert(result.second == U'\U0001F600');
+}
+
+TEST(Utf8EncodingTests, decode_prev_matches_decode) {
+    static constexpr auto test_case = [](const std::u8string_view input) -> void {
+        using Step = std::pair<std::ptrdiff_t, utf8::Expected<char32_t>>;
+
+        std::vector<Step> forward;
+        for(auto it = input.begin(); it != input.end();) {
+            auto [next, codepoint] = utf8::decode(it, input.end());
+
+            forward.emplace_back(it - input.begin(), codepoint);
+
+            it = next;
+        }
+
+        std::vector<Step> backward;
+        for(auto it = input.end(); it != input.begin();) {
+            auto [prev, codepoint] = utf8::decode_prev(input.begin(), it);
+
+            backward.emplace_back(prev - input.begin(), codepoint);
+
+            it = prev;
+        }
+
+        std::ranges::reverse(backward);
+
+        EXPECT_EQ(backward, forward);
+    };
+
+    test_case(u8"a\u00E9\u0800\U0010FFFF");
+    test_case(u8"\x80\x80\x80\x80\x80" u8"a");
+    test_case(u8"\xF0\x90\x80\x80\x80\x80\x80");
+    test_case(u8"\xE1\x80" u8"a\xC2");
+    test_case(u8"\xC0\xAF\xE0\x9F\xBF\xED\xA0\x80\xF4\x90\x80\x80\xFF\xF8");
+    test_case(u8"\xE0\x9F\x00\xF0\x90\xC3\xA9");
 }
 
 TEST(Utf8EncodingTests, encode_success) {
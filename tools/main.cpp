@@ -0,0 +1,302 @@
+#include "mapped_file.hpp"
+
+#include <utf8/utf8.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cerrno>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Repair and transcode work through the input in slices of about this size, so memory use stays bounded.
+    constexpr std::size_t SLICE_SIZE = std::size_t{ 4U } << 20U;
+
+    constexpr std::string_view USAGE =
+        "usage: utf8-tool validate [-j jobs] <path>...\n"
+        "       utf8-tool count [-j jobs] <path>...\n"
+        "       utf8-tool repair <input> <output>\n"
+        "       utf8-tool transcode <utf16|utf32> <input> <output>\n"
+        "\n"
+        "Directories are searched recursively. An output of - writes to standard output.";
+
+    [[nodiscard]] auto describe(const utf8::Error error) noexcept -> std::string_view {
+        switch(error) {
+            case utf8::Error::InvalidByteSequence:
+                return "invalid byte sequence";
+            case utf8::Error::InvalidCodepoint:
+                return "invalid codepoint";
+            case utf8::Error::OverlongEncoding:
+                return "overlong encoding";
+        }
+
+        return "unknown error";
+    }
+
+    // Moves `position` past at most 3 continuation units, so that slices split there decode independently.
+    [[nodiscard]] auto boundary(const std::span<const char8_t> input, std::size_t position) noexcept -> std::size_t {
+        for(std::size_t i = 0U; i < 3U && position < input.size(); ++i, ++position) {
+            if((input[position] & 0xC0U) != 0x80U) {
+                break;
+            }
+        }
+
+        return position;
+    }
+
+    // Calls `consume` with consecutive slices of `input` that start at sequence boundaries.
+    template<typename F>
+    auto for_each_slice(const std::span<const char8_t> input, F&& consume) -> void {
+        std::size_t first = 0U;
+
+        while(first != input.size()) {
+            const std::size_t last = boundary(input, std::min(first + SLICE_SIZE, input.size()));
+
+            consume(input.subspan(first, last - first));
+
+            first = last;
+        }
+    }
+
+    class OutputFile {
+    public:
+        explicit OutputFile(const std::string& path)
+            : m_file{ path == "-" ? stdout : std::fopen(path.c_str(), "wb") } {
+            if(m_file == nullptr) {
+                throw std::system_error{ errno, std::generic_category(), path };
+            }
+        }
+
+        OutputFile(const OutputFile&) = delete;
+
+        ~OutputFile() {
+            if(m_file != stdout) {
+                std::fclose(m_file);
+            }
+        }
+
+        auto operator=(const OutputFile&) -> OutputFile& = delete;
+
+        template<typename T>
+        auto write(const std::span<const T> data) -> void {
+            if(std::fwrite(data.data(), sizeof(T), data.size(), m_file) != data.size()) {
+                throw std::system_error{ errno, std::generic_category(), "write failed" };
+            }
+        }
+
+    private:
+        std::FILE* m_file;
+    };
+
+    struct Report {
+        std::string line;
+        bool        ok;
+    };
+
+    [[nodiscard]] auto validate_file(const std::filesystem::path& path) -> Report {
+        const MappedFile file{ path };
+
+        const auto result = utf8::ranges::validate(file.data());
+        if(!result.result) {
+            return {
+                std::format("{}: invalid at byte {}: {}", path.string(), result.valid, describe(result.result.error())),
+                false,
+            };
+        }
+
+        return { std::format("{}: valid", path.string()), true };
+    }
+
+    [[nodiscard]] auto count_file(const std::filesystem::path& path) -> Report {
+        const MappedFile file{ path };
+
+        const auto length = utf8::ranges::length(file.data());
+        if(!length) {
+            return { std::format("{}: {}", path.string(), describe(length.error())), false };
+        }
+
+        return { std::format("{}: {}", path.string(), *length), true };
+    }
+
+    [[nodiscard]] auto collect_files(const std::span<const std::string> operands) -> std::vector<std::filesystem::path> {
+        std::vector<std::filesystem::path> result;
+
+        for(const auto& operand : operands) {
+            if(!std::filesystem::is_directory(operand)) {
+                result.emplace_back(operand);
+                continue;
+            }
+
+            const auto first = result.size();
+
+            for(const auto& entry : std::filesystem::recursive_directory_iterator{ operand }) {
+                if(entry.is_regular_file()) {
+                    result.push_back(entry.path());
+                }
+            }
+
+            std::sort(result.begin() + static_cast<std::ptrdiff_t>(first), result.end());
+        }
+
+        return result;
+    }
+
+    // Runs `work` on every file on up to `jobs` threads and prints the reports in the order of the files.
+    // Returns whether every report was ok.
+    template<typename F>
+    [[nodiscard]] auto for_each_file(
+        const std::vector<std::filesystem::path>& files,
+        const std::size_t                         jobs,
+        F                                         work
+    ) -> bool {
+        std::vector<Report>      reports(files.size());
+        std::atomic<std::size_t> next{ 0U };
+
+        const auto worker = [&] {
+            for(std::size_t i = next++; i < files.size(); i = next++) {
+                try {
+                    reports[i] = work(files[i]);
+                } catch(const std::exception& exception) {
+                    reports[i] = { exception.what(), false };
+                }
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            for(std::size_t i = 1U; i < std::min(jobs, files.size()); ++i) {
+                threads.emplace_back(worker);
+            }
+
+            worker();
+        }
+
+        bool ok = true;
+        for(const auto& report : reports) {
+            std::println("{}", report.line);
+
+            ok = ok && report.ok;
+        }
+
+        return ok;
+    }
+
+    auto repair_file(const std::string& input, const std::string& output) -> void {
+        const MappedFile file{ input };
+        OutputFile       out{ output };
+
+        std::u8string buffer;
+
+        for_each_slice(file.data(), [&](const std::span<const char8_t> slice) {
+            if(utf8::ranges::is_valid(slice)) {
+                out.write(slice);
+                return;
+            }
+
+            buffer.clear();
+            utf8::ranges::repair(slice, std::back_inserter(buffer));
+
+            out.write(std::span<const char8_t>{ buffer });
+        });
+    }
+
+    template<typename T, typename F>
+    auto transcode_file(const std::string& input, const std::string& output, F transcode) -> void {
+        const MappedFile file{ input };
+        OutputFile       out{ output };
+
+        std::basic_string<T> buffer;
+
+        for_each_slice(file.data(), [&](const std::span<const char8_t> slice) {
+            buffer.clear();
+            transcode(slice, std::back_inserter(buffer));
+
+            out.write(std::span<const T>{ buffer });
+        });
+    }
+
+    [[nodiscard]] auto run(std::span<const std::string> arguments) -> int {
+        if(arguments.empty()) {
+            std::println(stderr, "{}", USAGE);
+            return 2;
+        }
+
+        const std::string command = arguments.front();
+        arguments = arguments.subspan(1U);
+
+        if(command == "validate" || command == "count") {
+            std::size_t jobs = std::max<std::size_t>(std::thread::hardware_concurrency(), 1U);
+
+            if(arguments.size() >= 2U && arguments[0U] == "-j") {
+                const auto& value = arguments[1U];
+
+                const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), jobs);
+                if(error != std::errc{} || end != value.data() + value.size() || jobs == 0U) {
+                    std::println(stderr, "invalid job count: {}", value);
+                    return 2;
+                }
+
+                arguments = arguments.subspan(2U);
+            }
+
+            if(arguments.empty()) {
+                std::println(stderr, "{}", USAGE);
+                return 2;
+            }
+
+            const auto files = collect_files(arguments);
+            const bool ok    = command == "validate"
+                ? for_each_file(files, jobs, validate_file)
+                : for_each_file(files, jobs, count_file);
+
+            return ok ? 0 : 1;
+        }
+
+        if(command == "repair" && arguments.size() == 2U) {
+            repair_file(arguments[0U], arguments[1U]);
+            return 0;
+        }
+
+        if(command == "transcode" && arguments.size() == 3U) {
+            if(arguments[0U] == "utf16") {
+                transcode_file<char16_t>(arguments[1U], arguments[2U], [](const auto slice, const auto out) {
+                    utf8::ranges::decode_utf16(slice, out);
+                });
+                return 0;
+            }
+
+            if(arguments[0U] == "utf32") {
+                transcode_file<char32_t>(arguments[1U], arguments[2U], [](const auto slice, const auto out) {
+                    utf8::ranges::decode_all(slice, out);
+                });
+                return 0;
+            }
+        }
+
+        std::println(stderr, "{}", USAGE);
+        return 2;
+    }
+}
+
+auto main(const int argc, char** const argv) -> int {
+    try {
+        const std::vector<std::string> arguments(argv + 1, argv + argc);
+
+        return run(arguments);
+    } catch(const std::exception& exception) {
+        std::println(stderr, "utf8-tool: {}", exception.what());
+        return 1;
+    }
+}
@@ -0,0 +1,123 @@
+#include "mapped_file.hpp"
+
+#include <system_error>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <cerrno>
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    const auto error = [&] {
+        return std::system_error{ static_cast<int>(GetLastError()), std::system_category(), path.string() };
+    };
+
+    const HANDLE file = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+    if(file == INVALID_HANDLE_VALUE) {
+        throw error();
+    }
+
+    LARGE_INTEGER size{};
+    if(!GetFileSizeEx(file, &size)) {
+        const auto exception = error();
+        CloseHandle(file);
+        throw exception;
+    }
+
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if(m_size == 0U) {
+        CloseHandle(file);
+        return;
+    }
+
+    m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(m_mapping == nullptr) {
+        const auto exception = error();
+        CloseHandle(file);
+        throw exception;
+    }
+
+    CloseHandle(file);
+
+    m_data = static_cast<const char8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if(m_data == nullptr) {
+        const auto exception = error();
+        CloseHandle(m_mapping);
+        throw exception;
+    }
+}
+
+MappedFile::~MappedFile() {
+    if(m_data != nullptr) {
+        UnmapViewOfFile(m_data);
+    }
+
+    if(m_mapping != nullptr) {
+        CloseHandle(m_mapping);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    const auto error = [&] {
+        return std::system_error{ errno, std::generic_category(), path.string() };
+    };
+
+    const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(file == -1) {
+        throw error();
+    }
+
+    struct stat status{};
+    if(fstat(file, &status) == -1) {
+        const auto exception = error();
+        close(file);
+        throw exception;
+    }
+
+    m_size = static_cast<std::size_t>(status.st_size);
+    if(m_size == 0U) {
+        close(file);
+        return;
+    }
+
+    void* const data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if(data == MAP_FAILED) {
+        const auto exception = error();
+        close(file);
+        throw exception;
+    }
+
+    close(file);
+
+    madvise(data, m_size, MADV_SEQUENTIAL);
+
+    m_data = static_cast<const char8_t*>(data);
+}
+
+MappedFile::~MappedFile() {
+    if(m_data != nullptr) {
+        munmap(const_cast<char8_t*>(m_data), m_size);
+    }
+}
+
+#endif
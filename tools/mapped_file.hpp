@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+// Read-only memory mapping of a whole file.
+class MappedFile {
+public:
+    // Throws std::system_error if the file cannot be opened or mapped.
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&)      = delete;
+
+    ~MappedFile();
+
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+    auto operator=(MappedFile&&) -> MappedFile&      = delete;
+
+    [[nodiscard]] auto data() const noexcept -> std::span<const char8_t> {
+        return { m_data, m_size };
+    }
+
+private:
+    const char8_t* m_data{};
+    std::size_t    m_size{};
+#if defined(_WIN32)
+    void* m_mapping{};
+#endif
+};